@@ -0,0 +1,246 @@
+/**
+ *  @file    bench_operators.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief  Micro-benchmarks of the GA operators
+ *
+ *  @section DESCRIPTION
+ *
+ *  Times the building blocks of the GA on each given instance:
+ *	construction of a TSPSolution, order (cut point) crossover,
+ *	inversion mutation, mating pool, population management and
+ *	Montecarlo selection, with the parameters used by main
+ *	(population of 3 * N, tournaments over 20% of it).
+ *	Every benchmark starts from a fixed seed, so runs are repeatable.
+ *	The results (ns/op, allocations/op, bytes/op) are written as JSON.
+ *
+ *	Usage:
+ *		bench [-t <seconds per benchmark>] [-o <output.json>] <instance>...
+ *
+ */
+
+#include "../include/GAPopulation.h"
+#include "../include/OrderCrossover.h"
+#include "../include/InversionMutation.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+
+#ifdef GA_PROFILE
+// Allocations are already counted by the profiler (see GAProfiler.h)
+static unsigned long allocations() { return GAProfiler::allocations(); }
+static unsigned long allocated_bytes() { return GAProfiler::allocated_bytes(); }
+#else
+static std::atomic<unsigned long> alloc_count(0);
+static std::atomic<unsigned long> alloc_bytes(0);
+
+void* operator new(size_t size) {
+	alloc_count.fetch_add(1, std::memory_order_relaxed);
+	alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+	void* p = malloc(size ? size : 1);
+	if (p == NULL) { throw std::bad_alloc(); }
+	return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+static unsigned long allocations() { return alloc_count.load(std::memory_order_relaxed); }
+static unsigned long allocated_bytes() { return alloc_bytes.load(std::memory_order_relaxed); }
+#endif
+
+static const uint64_t SEED = 1;
+static const unsigned int POPULATION_SIZE_FACTOR = 3;	// as in main
+static const unsigned int MATING_POOL_RATIO = 20;
+static const double MUTATION_PROBABILITY = 0.05;
+
+struct Result {
+	string benchmark;
+	string instance;
+	unsigned int N;
+	unsigned long iterations;
+	double ns_per_op;
+	double allocs_per_op;
+	double bytes_per_op;
+};
+
+/**
+*	@brief	Run <op> until <min_time> seconds are spent in it (at least
+*			<min_iterations> times), calling <setup> before each run,
+*			out of the timing and of the allocation counts.
+*
+*	@return the averages per run
+*/
+template <class Setup, class Op>
+Result measure(const string& benchmark, const string& instance, unsigned int N, \
+				double min_time, unsigned long min_iterations, Setup setup, Op op) {
+	typedef std::chrono::steady_clock Clock;
+
+	setup();	// warm up (caches, scratch buffers)
+	op();
+
+	// allocations made while a benchmark runs (the setup is not counted)
+	unsigned long iterations = 0;
+	double ns = 0;
+	unsigned long count = 0;
+	unsigned long bytes = 0;
+	while ((ns < min_time * 1e9) || (iterations < min_iterations)) {
+		setup();
+		unsigned long count_start = allocations();
+		unsigned long bytes_start = allocated_bytes();
+		Clock::time_point start = Clock::now();
+		op();
+		Clock::time_point end = Clock::now();
+		count += allocations() - count_start;
+		bytes += allocated_bytes() - bytes_start;
+		ns += std::chrono::duration<double, std::nano>(end - start).count();
+		iterations++;
+	}
+
+	Result r;
+	r.benchmark = benchmark;
+	r.instance = instance;
+	r.N = N;
+	r.iterations = iterations;
+	r.ns_per_op = ns / iterations;
+	r.allocs_per_op = count / (double) iterations;
+	r.bytes_per_op = bytes / (double) iterations;
+
+	cerr << "  " << benchmark << ": " << (long) r.ns_per_op << " ns/op, " << \
+		r.allocs_per_op << " allocs/op, " << (long) r.bytes_per_op << " bytes/op" << endl;
+	return r;
+}
+
+/**
+*	@brief	Run all the benchmarks on <instance>, adding to <results>
+*
+*	@return void
+*/
+void bench_instance(const string& instance, double min_time, vector<Result>& results) {
+	TSPProblem problem(instance);
+	unsigned int N = problem.get_size();
+	cerr << instance << " (" << N << " nodes)" << endl;
+
+	auto noop = [] {};
+	RandomEngine rng(SEED);
+
+	// Construction of a random individual
+	results.push_back(measure("tsp_solution", instance, N, min_time, 10, noop, [&] {
+		TSPSolution s(&problem, rng);
+	}));
+
+	// Operators on two fixed parents
+	rng.seed(SEED);
+	TSPSolution p1(&problem, rng);
+	TSPSolution p2(&problem, rng);
+	vector<Node> child(N + 1);
+	vector<Node> changed;
+	changed.reserve(N + 1);
+
+	OrderCrossover crossover;
+	rng.seed(SEED);
+	results.push_back(measure("cut_point_crossover", instance, N, min_time, 10, noop, [&] {
+		crossover.cross(&problem, &p1.get_path()[0], p1.get_solution_cost(), \
+						&p2.get_path()[0], &child[0], rng, changed);
+	}));
+
+	InversionMutation mutation;
+	uint64_t hash = 0;
+	rng.seed(SEED);
+	results.push_back(measure("mutate", instance, N, min_time, 10, [&] {
+		std::copy(p1.get_path().begin(), p1.get_path().end(), child.begin());
+		changed.clear();
+	}, [&] {
+		mutation.mutate(&problem, &child[0], hash, rng, changed);
+	}));
+
+	// Population steps (single thread)
+	GAPopulation<OrderRouletteGA> population(POPULATION_SIZE_FACTOR * N, MUTATION_PROBABILITY, \
+											&problem, SEED);
+	vector<Slot> pool;
+	vector<Slot> offspring;
+
+	results.push_back(measure("create_mating_pool", instance, N, min_time, 3, noop, [&] {
+		pool = population.create_mating_pool(MATING_POOL_RATIO);
+	}));
+
+	results.push_back(measure("population_management", instance, N, min_time, 3, [&] {
+		offspring = population.crossover(population.create_mating_pool(MATING_POOL_RATIO));
+	}, [&] {
+		population.population_management(offspring);
+	}));
+
+	results.push_back(measure("montecarlo_selection", instance, N, min_time, 3, [&] {
+		pool = population.get_elite(POPULATION_SIZE_FACTOR * N);
+	}, [&] {
+		population.montecarlo_selection(pool);
+	}));
+}
+
+/**
+*	@brief	Write <results> as a JSON array
+*
+*	@return void
+*/
+void write_json(ostream& out, const vector<Result>& results) {
+	out << std::fixed << std::setprecision(2);
+	out << "[" << endl;
+	for (unsigned int i = 0; i < results.size(); i++) {
+		const Result& r = results[i];
+		out << "  {\"benchmark\": \"" << r.benchmark << "\", " << \
+			"\"instance\": \"" << r.instance << "\", " << \
+			"\"n\": " << r.N << ", " << \
+			"\"iterations\": " << r.iterations << ", " << \
+			"\"ns_per_op\": " << r.ns_per_op << ", " << \
+			"\"allocs_per_op\": " << r.allocs_per_op << ", " << \
+			"\"bytes_per_op\": " << r.bytes_per_op << "}" << \
+			((i + 1 < results.size()) ? "," : "") << endl;
+	}
+	out << "]" << endl;
+}
+
+int main(int argc, char* argv[]) {
+	double min_time = 0.5;	// seconds per benchmark
+	string output_file;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "t:o:")) != -1) {
+		switch (opt) {
+			case 't': min_time = atof(optarg); break;
+			case 'o': output_file = optarg; break;
+			default: return -1;
+		}
+	}
+	if (optind >= argc) { return -1; }
+
+	vector<Result> results;
+	try {
+		for (int i = optind; i < argc; i++) {
+			bench_instance(argv[i], min_time, results);
+		}
+	} catch(std::exception& e) {
+		std::cout << "[!] EXCEPTION: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if (output_file.empty()) {
+		write_json(cout, results);
+	} else {
+		ofstream out(output_file);
+		write_json(out, results);
+	}
+	return 0;
+}
@@ -0,0 +1,70 @@
+/**
+ *  @file    BatchScheduler.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Batch scheduler class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  Runs a job (a solver) on a list of instances, several at once.
+ *	Every job uses <job_threads> threads and at most <threads>
+ *	threads are busy at the same time, optionally with a cap on
+ *	the jobs running together (e.g. CPLEX licenses).
+ *	Instances are loaded by a separate thread, ahead of the workers
+ *	(at most one waiting instance per worker), so loading overlaps
+ *	solving. Each job returns its results.csv row: rows are written
+ *	in instance order, as soon as all the previous ones are done.
+ *
+ */
+
+#ifndef BATCH_SCHEDULER_H_
+#define BATCH_SCHEDULER_H_
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "TSPProblem.h"
+
+using namespace std;
+
+class BatchScheduler {
+	public:
+		// solve <problem>, loaded from <instance>: returns the row of the results
+		typedef std::function<string(const string& instance, TSPProblem* problem)> Job;
+
+	private:
+		unsigned int workers;	// jobs running at the same time
+
+		vector<string> instances;
+		vector<TSPProblem*> problems;	// loaded, not yet solved
+		vector<string> errors;	// loading errors
+		vector<string> rows;
+		vector<char> loaded;
+		vector<char> done;
+		unsigned int next_job;	// next instance to solve
+		unsigned int waiting;	// instances loaded and not yet taken by a worker
+
+		std::mutex state_lock;
+		std::condition_variable load_slot;	// a worker took a loaded instance
+		std::condition_variable job_loaded;
+		std::condition_variable job_done;
+
+		void load_instances();
+		void run_jobs(Job job);
+
+	public:
+		BatchScheduler(unsigned int threads, unsigned int job_threads, unsigned int max_jobs = 0);
+
+		BatchScheduler(const BatchScheduler&) = delete;
+		BatchScheduler& operator=(const BatchScheduler&) = delete;
+
+		unsigned int get_workers() const;
+		void run(const vector<string>& instances, Job job, ostream& output);
+};
+
+#endif	// BATCH_SCHEDULER_H_
@@ -37,11 +37,17 @@ class CPLEXSolver {
 
 		TSPProblem* problem;	// the TSP problem to solve
 
-		vector<Node> extract_path(vector<double> vals, int start=0, int cnt=0);
+		vector<Node> extract_path(const vector<double>& vals);
 
 	public:
 		CPLEXSolver(TSPProblem* problem);
 		CPLEXSolver(TSPProblem* problem, unsigned int time_limit);
+		~CPLEXSolver();
+
+		CPLEXSolver(const CPLEXSolver&) = delete;
+		CPLEXSolver& operator=(const CPLEXSolver&) = delete;
+
+		void set_threads(unsigned int threads);
 		TSPSolution* solve();
 };
 
@@ -0,0 +1,77 @@
+/**
+ *  @file    EAXCrossover.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Edge assembly crossover class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  Edge assembly crossover (EAX, single AB-cycle version):
+ *	the edges of the two parents that are not shared form closed
+ *	trails alternating an edge of A and one of B (AB-cycles).
+ *	The child is A with the A-edges of one random AB-cycle replaced
+ *	by its B-edges; the subtours this may create are then joined
+ *	with the cheapest 2-opt style exchange among nearest neighbors.
+ *	Works on adjacency arrays kept between calls (no allocations
+ *	once warmed up). Symmetric problems only.
+ *
+ */
+
+#ifndef EAX_CROSSOVER_H_
+#define EAX_CROSSOVER_H_
+
+#include <vector>
+#include "TSPProblem.h"
+#include "RandomEngine.h"
+
+using namespace std;
+
+class EAXCrossover {
+	private:
+		TSPProblem* problem;
+		unsigned int N;
+
+		// adjacency arrays: the two neighbors of v are adj[2v], adj[2v+1] (-1: none)
+		vector<Node> adj_a;
+		vector<Node> adj_b;
+		vector<Node> adj_child;
+
+		// A-edges and B-edges not in the other parent and not used yet
+		vector<Node> free_a;	// free_a[2v .. 2v + count_a[v])
+		vector<Node> free_b;
+		vector<unsigned char> count_a;
+		vector<unsigned char> count_b;
+
+		// AB-cycles: cycle c is cycle_nodes[cycle_start[c], cycle_start[c+1])
+		// (its first node repeated at the end), edge i being an A-edge
+		// if i is even and a B-edge otherwise
+		vector<Node> cycle_nodes;
+		vector<unsigned int> cycle_start;
+
+		vector<int> subtour;	// subtour of each node in the child
+		vector<unsigned int> subtour_size;
+		vector<Node> subtour_first;	// a node of each subtour
+
+		void load_adjacency(const Node* path, vector<Node>& adj);
+		static void unlink(vector<Node>& adj, Node u, Node v);
+		static void link(vector<Node>& adj, Node u, Node v);
+		void build_ab_cycles(RandomEngine& rng);
+		double merge_subtours(vector<Node>& changed);
+		double merge_into_neighbor(int s, vector<Node>& changed);
+
+		inline Node next_in_child(Node v, Node prev) const {
+			return (this->adj_child[2*v] != prev) ? this->adj_child[2*v] : this->adj_child[2*v + 1];
+		}
+
+	public:
+		EAXCrossover();
+
+		static void prepare(TSPProblem* problem, unsigned int neighbors = 8);
+
+		double cross(TSPProblem* problem, const Node* p1, double p1_cost, const Node* p2, \
+					Node* child, RandomEngine& rng, vector<Node>& changed);
+};
+
+#endif	// EAX_CROSSOVER_H_
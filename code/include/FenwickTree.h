@@ -0,0 +1,38 @@
+/**
+ *  @file    FenwickTree.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Fenwick tree class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  A Fenwick (binary indexed) tree over a vector of non negative
+ *	weights: point updates, total and roulette-wheel search
+ *	in O(log n).
+ *
+ */
+
+#ifndef FENWICK_TREE_H_
+#define FENWICK_TREE_H_
+
+#include <vector>
+
+using namespace std;
+
+class FenwickTree {
+	private:
+		vector<double> tree;	// 1-based partial sums
+		unsigned int size;
+		unsigned int top_bit;	// highest power of two <= size
+
+	public:
+		FenwickTree();
+		void reset(const vector<double>& weights);
+		void add(unsigned int i, double delta);
+		double total() const;
+		unsigned int find(double value) const;
+};
+
+#endif	// FENWICK_TREE_H_
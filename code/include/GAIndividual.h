@@ -20,10 +20,13 @@
 #include "TSPSolution.h"
 #include "TSPProblem.h"
 
+typedef unsigned int Slot;	// index of an individual in the pool (see GAPopulation)
+
 class GAIndividual : public TSPSolution {
 	public:
-	    GAIndividual(TSPProblem *problem);
+	    GAIndividual(TSPProblem *problem, RandomEngine& rng);
 		GAIndividual(TSPProblem* problem, vector<Node> path);
+		GAIndividual(TSPProblem* problem, vector<Node> path, double fitness);
 
 		double get_fitness();
 };
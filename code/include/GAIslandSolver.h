@@ -0,0 +1,76 @@
+/**
+ *  @file    GAIslandSolver.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief GA island model solver class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  This class represents a solver for the TSP problem
+ *	using a genetic algorithm with an island model:
+ *	several populations evolve independently, each one on its
+ *	own thread, and from time to time send their best
+ *	individuals to other islands (migration).
+ *	Migrants travel through lock-free queues: no island ever
+ *	waits for another.
+ *	The operators of the GA are given by the template
+ *	argument <Operators> (see GAOperators).
+ *
+ */
+
+#ifndef GA_ISLAND_SOLVER_H_
+#define GA_ISLAND_SOLVER_H_
+
+#include "GAPopulation.h"
+#include "MigrationQueue.h"
+
+enum MigrationTopology {
+	RING,	// island i sends to island i+1
+	RANDOM	// island i sends to a random island
+};
+
+template <class Operators>
+class GAIslandSolver {
+	private:
+		static const unsigned int INBOX_CAPACITY = 16;	// migrants waiting for an island
+
+	    TSPProblem* problem;
+	    unsigned int population_size;	// per island
+	    long long time_limit;
+		unsigned int iterations_limit;
+	    double mutation_probability;
+		bool verbose;
+		unsigned int local_search_budget;	// memetic mode (0: off)
+		bool polish;	// improve the final tour with TSPSolution::improve()
+		RandomEngine seeds;	// gives each island its own random streams
+
+		unsigned int islands;
+		MigrationTopology topology;
+		unsigned int migration_interval;	// generations between two migrations
+		unsigned int migrants;	// individuals sent at each migration
+
+		vector< GAPopulation<Operators>* > populations;	// one per island
+		vector< MigrationQueue* > inboxes;	// migrants to each island
+		vector< unsigned int > generations;	// generations run by each island
+
+		void run_island(unsigned int island, long long t_start);
+		void migrate(unsigned int island, RandomEngine& rng);
+
+	public:
+	    GAIslandSolver(TSPProblem *problem, unsigned int pop_size_factor,\
+				unsigned int t_limit, unsigned int itr_limit, \
+				double mutation_pr,
+				unsigned int n_islands,
+				MigrationTopology topology = RING,
+				bool vvv = false,
+				uint64_t seed = 0);
+	    void set_local_search(unsigned int budget);
+	    void set_polish(bool polish);
+	    GAIndividual* solve();
+
+		long long current_timestamp();
+};
+
+#endif	// GA_ISLAND_SOLVER_H_
@@ -0,0 +1,50 @@
+/**
+ *  @file    GAOperators.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief GA operators header
+ *
+ *  @section DESCRIPTION
+ *
+ *  The operators of the GA are policy classes, given to
+ *	GAPopulation (and to the solvers) as a template argument:
+ *	calls are resolved at compile time and the small operators
+ *	are inlined in the GA loops. Each operator class provides
+ *		Selection:		Slot select(population, fitness, K, rng)
+ *		Crossover:		static void prepare(problem)
+ *						double cross(problem, p1, p1 cost, p2, child, rng, changed)
+ *		Mutation:		double mutate(problem, path, hash, rng, changed)
+ *		Replacement:	void replace(population, offspring, fitness, size, rng, discarded)
+ *	and is instantiated once per thread (it can keep scratch buffers).
+ *	The configurations below are the ones compiled in (see the
+ *	explicit instantiations at the end of GAPopulation.cpp,
+ *	GASolver.cpp and GAIslandSolver.cpp).
+ *
+ */
+
+#ifndef GA_OPERATORS_H_
+#define GA_OPERATORS_H_
+
+#include "TournamentSelection.h"
+#include "OrderCrossover.h"
+#include "EAXCrossover.h"
+#include "InversionMutation.h"
+#include "RouletteReplacement.h"
+#include "TruncationReplacement.h"
+
+template <class S, class C, class M, class R>
+struct GAOperators {
+	typedef S Selection;
+	typedef C Crossover;
+	typedef M Mutation;
+	typedef R Replacement;
+};
+
+typedef GAOperators<TournamentSelection, OrderCrossover, InversionMutation, RouletteReplacement> OrderRouletteGA;
+typedef GAOperators<TournamentSelection, OrderCrossover, InversionMutation, TruncationReplacement> OrderTruncationGA;
+typedef GAOperators<TournamentSelection, EAXCrossover, InversionMutation, RouletteReplacement> EAXRouletteGA;
+typedef GAOperators<TournamentSelection, EAXCrossover, InversionMutation, TruncationReplacement> EAXTruncationGA;
+
+#endif	// GA_OPERATORS_H_
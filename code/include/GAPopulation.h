@@ -12,15 +12,38 @@
  *	and containts the functions to build, evolge and manage the
  *	population.
  *
+ *	Individuals are stored in a pool: all the tours are in one
+ *	contiguous buffer and the fitness values in a parallel array,
+ *	both indexed by slot. Slots of discarded individuals are
+ *	recycled for the offspring, so memory does not grow over time.
+ *	Each tour also has a hash (see TourHash): offspring that are
+ *	clones of an individual of the population, or of each other,
+ *	are dropped before the local search and before the replacement.
+ *
+ *	The operators (selection, crossover, mutation, replacement)
+ *	are given by the template argument <Operators> (see GAOperators).
+ *
  */
 
 #ifndef GA_POPULATION_H_
 #define GA_POPULATION_H_
 
 #include "GAIndividual.h"
+#include "GAOperators.h"
+#include "GAProfiler.h"
+#include "RandomEngine.h"
+#include "ThreadPool.h"
+#include "TwoOptSearch.h"
+#include "TourHash.h"
 
+template <class Operators>
 class GAPopulation {
 	private:
+		typedef typename Operators::Selection Selection;
+		typedef typename Operators::Crossover Crossover;
+		typedef typename Operators::Mutation Mutation;
+		typedef typename Operators::Replacement Replacement;
+
 		// Algorithm parameters
 		unsigned int population_size;
 		double mutation_probability;
@@ -29,24 +52,88 @@ class GAPopulation {
 		// Population parameters
 		TSPProblem* problem;
 
-		vector< GAIndividual* > population;	// Actual population
-		vector< GAIndividual* > mating_pool;	// current parents set
+		// Pool of individuals
+		unsigned int tour_length;	// N+1 (node 0 at both ends)
+		vector<Node> tours;	// slot s tour: [s*tour_length, (s+1)*tour_length)
+		vector<double> fitness;	// slot s fitness
+		vector<uint64_t> hashes;	// slot s tour hash
+		vector<Slot> free_slots;	// slots to be used by the offspring
+
+		vector<Slot> population;	// Actual population
+
+		// Duplicate elimination (see crossover())
+		vector<uint64_t> population_hashes;	// hashes of the population, sorted
+		vector<char> rejected;	// offspring found to be clones
+		vector< pair<uint64_t, unsigned int> > offspring_hashes;	// (hash, offspring index)
+
+		// Parallel generation: offspring are produced in chunks of
+		// CHUNK_SIZE, each one with its own random stream, by the
+		// workers of the pool (if any).
+		static const unsigned int CHUNK_SIZE = 16;
+
+		struct Workspace {	// per-thread random engine, operators and scratch buffers
+			RandomEngine rng;
+			Selection selection;
+			Crossover crossover;
+			Mutation mutation;
+			vector<double> mutation_draws;	// crossover: one draw per child of the chunk
+			vector<Node> changed_nodes;	// nodes of the last child whose edges
+										// differ from its first parent
+			TwoOptSearch local_search;
+		};
+
+		ThreadPool* workers;	// NULL: everything runs on the caller's thread
+		vector<Workspace> workspaces;	// one per worker
+		RandomEngine rng;	// caller's thread: chunk seeds and survivor selection
 
-		GAIndividual* choose_best(vector<GAIndividual*> pool);
-		GAIndividual* choose_random(vector<GAIndividual*> pool, vector<GAIndividual*>  not_good);
+		unsigned int local_search_budget;	// memetic mode (0: off), see enable_local_search()
+		GAProfiler* profiler;	// per-thread times of the chunks (GA_PROFILE builds), may be NULL
 
-		static bool sort_by_fitness(GAIndividual* p, GAIndividual* p2);
+		void run_chunks(unsigned int items, std::function<void(unsigned int, unsigned int, Workspace&)> body);
+
+		vector<Node> diversity_next;	// scratch of get_diversity()
+		vector<Node> diversity_prev;
+
+		Replacement replacement;	// survivor selection (caller's thread)
+		vector<Slot> discarded;	// slots left out by the replacement
+
+		Slot acquire_slot();
+		void release_slot(Slot s);
+
+		void index_population();
+		inline bool in_population(uint64_t hash) const {
+			return std::binary_search(this->population_hashes.begin(), this->population_hashes.end(), hash);
+		}
+		void drop_clones(vector< Slot >& offsprings);
+
+		void mutate(Slot individual, double draw, Workspace& ws);
+		void local_search(Slot individual, Workspace& ws);
 
 	public:
-	    GAPopulation(unsigned int size, double mutation_probability, TSPProblem* problem);
-		vector< GAIndividual* > create_mating_pool(unsigned int ratio);
-		vector< GAIndividual* > crossover(vector< GAIndividual* > pool);
-		GAIndividual* cut_point_crossover(GAIndividual* p1, GAIndividual* p2);
-		GAIndividual* mutate(GAIndividual* individual);
-		void population_management(vector< GAIndividual* > pool);
-		GAIndividual* montecarlo_selection(vector< GAIndividual* > pool);
+	    GAPopulation(unsigned int size, double mutation_probability, TSPProblem* problem, \
+					uint64_t seed, ThreadPool* workers = NULL);
+		vector< Slot > create_mating_pool(unsigned int ratio);
+		vector< Slot > crossover(const vector< Slot >& pool);
+		void population_management(const vector< Slot >& pool);
+		Slot montecarlo_selection(vector< Slot > pool);
+		void enable_local_search(unsigned int budget, unsigned int neighbors = 8);
+		inline void set_profiler(GAProfiler* profiler) { this->profiler = profiler; }
+
+		inline Node* get_tour(Slot s) { return &tours[(size_t) s * tour_length]; }
+		inline double get_fitness(Slot s) const { return fitness[s]; }
+
+		Slot get_best_slot();
+		Slot get_worst_slot();
+		double get_best_fitness();
+		double get_worst_fitness();
+		double get_mean_fitness() const;
+		double get_diversity(unsigned int pairs = 8);
 		GAIndividual* get_best_individual();
 		GAIndividual* get_worst_individual();
+
+		// Migration (island model)
+		vector< Slot > get_elite(unsigned int k);
+		bool replace_worst(const Node* tour, double tour_fitness);
 };
 
 #endif	// GA_POPULATION_H_
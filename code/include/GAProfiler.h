@@ -0,0 +1,100 @@
+/**
+ *  @file    GAProfiler.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief GA profiler class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  Wall time, calls and allocations of the phases of a GA run:
+ *	totals, per generation and, for the offspring production, per
+ *	worker thread. At the end of the run a table is printed and a
+ *	JSON line is appended to OUTPUT_FILE.
+ *	Only compiled in with -DGA_PROFILE (make GA_PROFILE=1): otherwise
+ *	GA_PROFILE_SCOPE() and GA_PROFILE_GENERATION() expand to nothing,
+ *	so the GA pays nothing for it. In profiling builds every allocation
+ *	(global operator new) is counted.
+ *
+ */
+
+#ifndef GA_PROFILER_H_
+#define GA_PROFILER_H_
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+enum GAPhase {
+	GA_PHASE_INIT,	// first population
+	GA_PHASE_MATING_POOL,
+	GA_PHASE_CROSSOVER,	// crossover, mutation and local search
+	GA_PHASE_MANAGEMENT,	// population management
+	GA_PHASE_SCAN,	// best and worst individual scans
+	GA_PHASE_POLISH,
+	GA_PHASE_COUNT
+};
+
+class GAProfiler {
+	private:
+		typedef std::chrono::steady_clock Clock;
+
+		struct Stats {
+			unsigned long calls;
+			unsigned long long ns;
+			unsigned long allocations;
+		};
+
+		unsigned int problem_size;
+		unsigned int threads;
+		Stats phases[GA_PHASE_COUNT];
+		vector< vector<unsigned long long> > generations;	// ns of each phase, per generation
+		vector<Stats> workers;	// chunks of offspring production, per worker thread
+
+		static const char* phase_name(unsigned int phase);
+
+	public:
+		static const char* OUTPUT_FILE;
+
+		// Time (and allocations) of a block, added to <phase> when it ends
+		class Scope {
+			private:
+				GAProfiler* profiler;
+				GAPhase phase;
+				Clock::time_point start;
+				unsigned long allocations;
+
+			public:
+				Scope(GAProfiler* profiler, GAPhase phase);
+				~Scope();
+		};
+
+		GAProfiler(unsigned int problem_size, unsigned int threads);
+
+		void start_generation();
+		void add(GAPhase phase, unsigned long long ns, unsigned long allocations);
+		void add_worker(unsigned int worker, unsigned long long ns, unsigned long allocations);
+
+		void print(ostream& out) const;
+		void write_json(ostream& out) const;
+		void append_json(const string& filename) const;
+
+		// allocations so far (profiling builds only, 0 otherwise)
+		static unsigned long allocations();
+		static unsigned long allocated_bytes();
+		static unsigned long thread_allocations();
+};
+
+#ifdef GA_PROFILE
+#define GA_PROFILE_SCOPE(profiler, phase) GAProfiler::Scope ga_profile_scope(profiler, phase)
+#define GA_PROFILE_GENERATION(profiler) (profiler)->start_generation()
+#else
+#define GA_PROFILE_SCOPE(profiler, phase)
+#define GA_PROFILE_GENERATION(profiler)
+#endif
+
+#endif	// GA_PROFILER_H_
@@ -10,6 +10,8 @@
  *
  *  This class represents a solver for the TSP problem
  *	using a genetic algorithm.
+ *	The operators of the GA are given by the template
+ *	argument <Operators> (see GAOperators).
  *
  */
 
@@ -17,7 +19,9 @@
 #define GA_SOLVER_H_
 
 #include "GAPopulation.h"
+#include "TraceWriter.h"
 
+template <class Operators>
 class GASolver {
 	private:
 	    TSPProblem* problem;
@@ -26,15 +30,28 @@ class GASolver {
 		unsigned int iterations_limit;
 	    double mutation_probability;
 		bool verbose;
+		unsigned int local_search_budget;	// memetic mode (0: off)
+		bool polish;	// improve the final tour with TSPSolution::improve()
+		unsigned int threads;	// threads used to produce the offspring
+		uint64_t seed;	// seed of the random engines (same seed: same run)
+		string trace_file;	// convergence trace (empty: none), see TraceWriter
 
-	    GAPopulation* population;
+	    GAPopulation<Operators>* population;
+
+		void trace_generation(TraceWriter* trace, GAPopulation<Operators>* population, \
+							unsigned int generation, long long elapsed, double best, double worst);
 
 	public:
 	    GASolver(TSPProblem *problem, unsigned int pop_size_factor,\
 				unsigned int t_limit, unsigned int itr_limit, \
 				double mutation_pr,
-				bool vvv = false);
+				bool vvv = false,
+				unsigned int n_threads = 1,
+				uint64_t seed = 0);
 	    // ~GASolver(){ problem = NULL; delete population;}
+	    void set_local_search(unsigned int budget);
+	    void set_polish(bool polish);
+	    void set_trace(const string& filename);
 	    GAIndividual* solve();
 
 		long long current_timestamp();
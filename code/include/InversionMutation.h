@@ -0,0 +1,64 @@
+/**
+ *  @file    InversionMutation.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Inversion mutation class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  Mutation operator of the GA (see GAOperators): the block
+ *	between two random positions is reversed.
+ *	Defined here so that it is inlined in the GA loops.
+ *
+ */
+
+#ifndef INVERSION_MUTATION_H_
+#define INVERSION_MUTATION_H_
+
+#include <vector>
+#include <algorithm>
+#include "TSPSolution.h"
+#include "RandomEngine.h"
+
+using namespace std;
+
+class InversionMutation {
+	public:
+		/**
+		*	@brief	Mutate <path> (N+1 nodes, 0 at both ends) in place,
+		*			updating its <hash> (see TourHash).
+		*			The nodes whose edges changed are added to <changed>.
+		*
+		*	@return the change of the cost of the path
+		*/
+		inline double mutate(TSPProblem* problem, Node* path, uint64_t& hash, RandomEngine& rng, vector<Node>& changed) {
+			unsigned int z, t;
+			unsigned int N = problem->get_size();
+
+			// Computing the two points randomly, s.t.
+			// - z,t >= 1, z, t <= problem.N
+			// - z < t
+			while (1) {
+				z = rng.uniform_int(N-1) + 1;
+				t = rng.uniform_int(N-1) + 1;
+
+				if (z < t) break;
+			}
+
+			// only the edges at the borders of the reversed block change
+			double delta = TSPSolution::reversal_delta(problem, path, z, t);
+			hash ^= TourHash::reversal_delta(path, z, t, problem->is_symmetric());
+
+			// do the magic (the first and the last part are the same)
+			std::reverse(path + z, path + t + 1);
+			changed.push_back(path[z - 1]);
+			changed.push_back(path[z]);
+			changed.push_back(path[t]);
+			changed.push_back(path[t + 1]);
+			return delta;
+		}
+};
+
+#endif	// INVERSION_MUTATION_H_
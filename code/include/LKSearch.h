@@ -0,0 +1,43 @@
+/**
+ *  @file    LKSearch.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Lin-Kernighan local search class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  A Lin-Kernighan style local search working in place on a tour
+ *	buffer (see LocalSearch). A move is a chain of up to MAX_DEPTH
+ *	2-opt moves sharing the node t1 (a sequential move of up to
+ *	MAX_DEPTH+1 edges): the chain goes on while the partial gain is
+ *	positive and is applied as soon as closing it improves the tour.
+ *	The first levels try several candidates (see BREADTH), the
+ *	deeper ones only the most promising one.
+ *	Symmetric problems only (2-opt moves reverse segments).
+ *
+ */
+
+#ifndef LK_SEARCH_H_
+#define LK_SEARCH_H_
+
+#include "LocalSearch.h"
+
+class LKSearch : public LocalSearch {
+	private:
+		static const unsigned int MAX_DEPTH = 4;	// 2-opt moves in a chain: 5-opt moves
+		static const unsigned int BREADTH[MAX_DEPTH];	// candidates tried at each level
+
+		vector<Node> touched;	// nodes of the chain being built
+
+		inline Node succ(Node n) const { return this->path[edge_after(n) + 1]; }
+		inline Node pred(Node n) const { return this->path[edge_before(n)]; }
+
+		bool improve_node(Node a, double& delta);
+		bool extend(Node t1, Node t2, unsigned int level, double chain_delta, double& delta);
+		void flip(Node t1, Node t2, Node t3, Node t4, unsigned int& p, unsigned int& q);
+		void reverse(unsigned int p, unsigned int q);
+};
+
+#endif	// LK_SEARCH_H_
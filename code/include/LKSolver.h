@@ -0,0 +1,52 @@
+/**
+ *  @file    LKSolver.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief LK Solver class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  This class represents a solver for the TSP problem
+ *	using an iterated Lin-Kernighan local search: a pseudo-greedy
+ *	tour is improved with LK and Or-opt moves, then again and again
+ *	after random kicks (double bridge moves), keeping the best tour.
+ *	On asymmetric problems only Or-opt moves are used.
+ *
+ */
+
+#ifndef LK_SOLVER_H_
+#define LK_SOLVER_H_
+
+#include "TSPSolution.h"
+#include "LKSearch.h"
+#include "OrOptSearch.h"
+
+class LKSolver {
+	private:
+		static const unsigned int NEIGHBORS = 8;	// candidates of each node
+		static const unsigned int KICK_WINDOW = 50;	// max span of a kick (positions)
+
+		TSPProblem* problem;
+		long long time_limit;
+		unsigned int iterations_limit;	// kicks
+		bool verbose;
+		uint64_t seed;
+
+		LKSearch lk;
+		OrOptSearch or_opt;
+
+		double descend(Node* tour, const Node* starts, unsigned int count);
+		double kick(Node* tour, RandomEngine& rng, Node* ends);
+
+	public:
+		LKSolver(TSPProblem* problem, unsigned int t_limit, unsigned int itr_limit, \
+				bool vvv = false,
+				uint64_t seed = 0);
+		TSPSolution* solve();
+
+		long long current_timestamp();
+};
+
+#endif	// LK_SOLVER_H_
@@ -0,0 +1,38 @@
+/**
+ *  @file    ListTwoOptSearch.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief 2-opt local search on a two-level list, class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  The same 2-opt local search of TwoOptSearch, with the tour held
+ *	in a two-level doubly-linked list (see TwoLevelList): a move
+ *	costs O(sqrt(N)) instead of O(N), which pays off on large
+ *	instances. The tour buffer is only read by load() and written
+ *	back by store(): the positions of the base class are not kept
+ *	up to date in between.
+ *	Symmetric problems only.
+ *
+ */
+
+#ifndef LIST_TWO_OPT_SEARCH_H_
+#define LIST_TWO_OPT_SEARCH_H_
+
+#include "LocalSearch.h"
+#include "TwoLevelList.h"
+
+class ListTwoOptSearch : public LocalSearch {
+	private:
+		TwoLevelList tour;
+
+		bool improve_node(Node a, double& delta);
+
+	public:
+		void load(TSPProblem* problem, Node* path);
+		void store();
+};
+
+#endif	// LIST_TWO_OPT_SEARCH_H_
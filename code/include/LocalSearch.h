@@ -0,0 +1,71 @@
+/**
+ *  @file    LocalSearch.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Local search base class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  Common part of the local searches working in place on a tour
+ *	buffer (N+1 nodes, node 0 at both ends): position of the nodes,
+ *	"don't look bits" and the queue of the nodes to look at.
+ *	At start only the nodes given with activate() are looked at,
+ *	then the ones touched by every applied move. Subclasses say how
+ *	to improve the tour around a node (improve_node()).
+ *	The change of the hash of the tour (see TourHash) is tracked
+ *	along with the moves, so it can be updated without a new pass.
+ *	Moves are looked for among the nearest neighbors of each node
+ *	(see TSPProblem::build_neighbors()).
+ *
+ */
+
+#ifndef LOCAL_SEARCH_H_
+#define LOCAL_SEARCH_H_
+
+#include <vector>
+#include "TSPProblem.h"
+#include "NeighborLists.h"
+#include "TourHash.h"
+
+using namespace std;
+
+class LocalSearch {
+	protected:
+		static constexpr double EPSILON = 1e-9;	// smaller gains are rounding errors
+
+		TSPProblem* problem;
+		Node* path;
+		unsigned int N;
+
+		vector<unsigned int> position;	// position of each node in the path (node 0: 0)
+		vector<char> active;	// don't look bits, inverted: 1 = to be looked at
+		vector<Node> queue;	// active nodes (circular, at most N)
+		unsigned int queue_head;
+		unsigned int queue_count;
+		bool symmetric;	// edges of the problem are undirected (see TourHash)
+		uint64_t hash_delta;	// XOR of the keys of the edges changed so far (see TourHash)
+
+		// edge i goes from path[i] to path[i+1]
+		inline unsigned int edge_after(Node n) const { return this->position[n]; }
+		inline unsigned int edge_before(Node n) const {
+			return (this->position[n] == 0) ? this->N - 1 : this->position[n] - 1;
+		}
+		void update_positions(unsigned int from, unsigned int to);
+		inline void toggle_edge(Node u, Node v) { this->hash_delta ^= TourHash::key(u, v, this->symmetric); }
+
+		virtual bool improve_node(Node a, double& delta) = 0;
+
+	public:
+		LocalSearch();
+		virtual ~LocalSearch() {}
+
+		void load(TSPProblem* problem, Node* path);
+		void activate(Node n);
+		void activate_positions(unsigned int from, unsigned int to);
+		double optimize(unsigned int budget = 0);
+		inline uint64_t get_hash_delta() const { return this->hash_delta; }
+};
+
+#endif	// LOCAL_SEARCH_H_
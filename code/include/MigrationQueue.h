@@ -0,0 +1,57 @@
+/**
+ *  @file    MigrationQueue.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Migration queue class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  A bounded lock-free queue of tours, used to move individuals
+ *	between islands. Any island can push (multi-producer), the
+ *	owner pops; nobody ever waits: a push on a full queue or a pop
+ *	on an empty one just fails.
+ *	(Bounded MPMC queue by D. Vyukov: each cell has a sequence number
+ *	telling whether it's free or full for the current turn.)
+ *
+ */
+
+#ifndef MIGRATION_QUEUE_H_
+#define MIGRATION_QUEUE_H_
+
+#include <atomic>
+#include <vector>
+#include "TSPProblem.h"
+
+using namespace std;
+
+class MigrationQueue {
+	private:
+		struct Cell {
+			std::atomic<size_t> sequence;
+			vector<Node> tour;
+			double fitness;
+		};
+
+		vector<Cell> cells;
+		size_t mask;	// capacity - 1 (capacity is a power of two)
+
+		// producers and consumer positions on separate cache lines
+		char pad0[64];
+		std::atomic<size_t> push_position;
+		char pad1[64 - sizeof(std::atomic<size_t>)];
+		std::atomic<size_t> pop_position;
+		char pad2[64 - sizeof(std::atomic<size_t>)];
+
+	public:
+		MigrationQueue(unsigned int capacity, unsigned int tour_length);
+
+		MigrationQueue(const MigrationQueue&) = delete;
+		MigrationQueue& operator=(const MigrationQueue&) = delete;
+
+		bool push(const Node* tour, double fitness);
+		bool pop(Node* tour, double& fitness);
+};
+
+#endif	// MIGRATION_QUEUE_H_
@@ -0,0 +1,55 @@
+/**
+ *  @file    NeighborLists.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Neighbor lists class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  The k nearest neighbors of every node of a problem, closest
+ *	first, in a compressed (CSR) layout: the neighbors of node i are
+ *	list[start[i], start[i+1]). They restrict the moves of the local
+ *	searches (and anything else needing candidates).
+ *	With coordinates the lists come from a uniform grid over the
+ *	points (each query only looks at the cells around the node),
+ *	otherwise from a partial sort of each row of the costs.
+ *	Both builds can run on several threads for large problems.
+ *	Owned and cached by TSPProblem (see TSPProblem::build_neighbors()).
+ *
+ */
+
+#ifndef NEIGHBOR_LISTS_H_
+#define NEIGHBOR_LISTS_H_
+
+#include <functional>
+#include <vector>
+#include "TSPProblem.h"
+
+using namespace std;
+
+class NeighborLists {
+	private:
+		static const unsigned int PARALLEL_SIZE = 1000;	// smaller problems: one thread
+		static const unsigned int CHUNK_SIZE = 64;	// nodes per parallel task
+
+		unsigned int k;
+		vector<unsigned int> start;	// N+1 offsets
+		vector<Node> list;
+
+		void resize(unsigned int N, unsigned int k);
+		void for_each_node(unsigned int N, unsigned int threads, std::function<void(unsigned int, unsigned int)> body);
+
+	public:
+		NeighborLists();
+
+		void build_from_points(const vector<double>& x, const vector<double>& y, unsigned int k, unsigned int threads = 1);
+		void build_from_costs(const TSPProblem& problem, unsigned int k, unsigned int threads = 1);
+
+		inline unsigned int size() const { return this->k; }
+		inline const Node* begin(Node i) const { return this->list.data() + this->start[i]; }
+		inline const Node* end(Node i) const { return this->list.data() + this->start[i + 1]; }
+};
+
+#endif	// NEIGHBOR_LISTS_H_
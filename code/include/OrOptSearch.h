@@ -0,0 +1,33 @@
+/**
+ *  @file    OrOptSearch.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Or-opt local search class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  An Or-opt local search working in place on a tour buffer
+ *	(see LocalSearch): a segment of 1 to MAX_SEGMENT nodes is moved
+ *	somewhere else in the tour, as it is or reversed (a restricted
+ *	3-opt move). The new place is next to a neighbor of one of the
+ *	segment ends. Works on asymmetric problems too.
+ *
+ */
+
+#ifndef OR_OPT_SEARCH_H_
+#define OR_OPT_SEARCH_H_
+
+#include "LocalSearch.h"
+
+class OrOptSearch : public LocalSearch {
+	private:
+		static const unsigned int MAX_SEGMENT = 3;
+
+		bool improve_node(Node a, double& delta);
+		bool improve_segment(unsigned int i, unsigned int j, double& delta);
+		void apply_move(unsigned int i, unsigned int j, unsigned int e, bool reversed);
+};
+
+#endif	// OR_OPT_SEARCH_H_
@@ -0,0 +1,118 @@
+/**
+ *  @file    OrderCrossover.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Order crossover class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  Recombination operator of the GA (see GAOperators):
+ *	2 cut-point order crossover.
+ *	Defined here so that it is inlined in the GA loops.
+ *
+ */
+
+#ifndef ORDER_CROSSOVER_H_
+#define ORDER_CROSSOVER_H_
+
+#include <assert.h>
+#include <vector>
+#include "TSPSolution.h"
+#include "RandomEngine.h"
+
+using namespace std;
+
+class OrderCrossover {
+	private:
+		vector<char> used_genes;	// genes already in the child
+
+	public:
+		/**
+		*	@brief	Nothing to prepare (no neighbor lists needed)
+		*
+		*	@return void
+		*/
+		static void prepare(TSPProblem* problem) {}
+
+		/**
+		*	@brief	Generate an individual from another two using 2-cut point crossover.
+		*
+		*	@section DESCRIPTION
+		*	After K cut points are defined, the child is obtained by copying
+		*	the block between the cut points from the first and the second parents
+		*	alternatively.
+		*	We use K=2, so it's a 2-cyt point crossover.
+		*	In order to preserve feasible solutions, the order crossover is implemented.
+		*	the child takes the external blocks from one parent and the inner genes
+		*	are taken from the second parent in order of their appearance in the second parent.
+		*	The nodes of the inner block are put in <changed>.
+		*
+		*	@return the cost of the child
+		*/
+		inline double cross(TSPProblem* problem, const Node* p1_path, double p1_cost, const Node* p2_path, \
+							Node* child_path, RandomEngine& rng, vector<Node>& changed) {
+			unsigned int k1, k2;
+			unsigned int N = problem->get_size();
+
+			// Computing the two k points randomly, s.t.
+			// - k1, k2 >= 1, k1, k2 <= problem.N
+			// - k2 - k1 > 2
+			while (1) {
+				k1 = rng.uniform_int(N-1) + 1;
+				k2 = rng.uniform_int(N-1) + 1;
+
+				if (( k2 <= k1) || ((k2 - k1) < 2)) { continue; }
+				break;
+			}
+
+			// Mark the genes already taken from the first parent:
+			// the others will be taken from the second
+			vector<char>& used = this->used_genes;
+			used.assign(N, 0);
+
+			// copying the first external block (left)
+			for (unsigned int i = 0; i <= k1; i++) {
+				child_path[i] = p1_path[i];
+				used[p1_path[i]] = 1;
+			}
+
+			// copyin the external block (right)
+			for (unsigned int i = k2; i <= N; i++) {
+				child_path[i] = p1_path[i];
+				used[p1_path[i]] = 1;
+			}
+
+			// create the inner block by copying the remaing nodes
+			// from the second parent, in order of appearance:
+			// a single pass over p2, starting in the first free p1 position (k1+1)
+			unsigned int i = k1+1;
+			for (unsigned int j = 1; (j < N) && (i < k2); j++) {
+				Node el = p2_path[j];
+				if (!used[el]) {
+					child_path[i++] = el;
+				}
+			}
+			assert(i == k2);
+
+			// final check: node 0 should be in the first and in the last positions only
+			// if not, something went wrong
+			unsigned int zeros = 2;
+			for (unsigned int i = 0; i <= N; i++) {
+				if (child_path[i] == 0) {
+					zeros--;
+				}
+			}
+			assert(zeros == 0);
+			changed.assign(child_path + k1, child_path + k2 + 1);
+
+			// The child shares the edges of p1 outside [k1, k2]:
+			// its cost is p1's one with the inner edges replaced
+			return p1_cost \
+				- TSPSolution::path_cost(problem, p1_path, k1, k2) \
+				+ TSPSolution::path_cost(problem, child_path, k1, k2);
+		}
+};
+
+#endif	// ORDER_CROSSOVER_H_
@@ -0,0 +1,80 @@
+/**
+ *  @file    RandomEngine.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Random engine class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  A small and fast pseudo-random generator (xoshiro256**).
+ *	Unlike rand() it has no global state: each solver (or thread)
+ *	owns its engine, so sequences are reproducible from a seed.
+ *	Independent streams of the same seed are obtained with
+ *	seed(seed, stream), e.g. one per thread or per island.
+ *
+ */
+
+#ifndef RANDOM_ENGINE_H_
+#define RANDOM_ENGINE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+class RandomEngine {
+	private:
+		uint64_t state[4];
+
+		static inline uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+	public:
+		RandomEngine(uint64_t seed = 0);
+		void seed(uint64_t seed);
+		void seed(uint64_t seed, uint64_t stream);
+
+		/**
+		*	@brief	Next 64 random bits
+		*/
+		inline uint64_t next() {
+			uint64_t result = rotl(state[1] * 5, 7) * 9;
+			uint64_t t = state[1] << 17;
+			state[2] ^= state[0];
+			state[3] ^= state[1];
+			state[1] ^= state[2];
+			state[0] ^= state[3];
+			state[2] ^= t;
+			state[3] = rotl(state[3], 45);
+			return result;
+		}
+
+		/**
+		*	@brief	Uniform integer in [0, n), n > 0 (unbiased)
+		*/
+		inline unsigned int uniform_int(unsigned int n) {
+			uint64_t m = (next() >> 32) * (uint64_t) n;
+			uint32_t low = (uint32_t) m;
+			if (low < n) {
+				uint32_t threshold = (uint32_t) (-n) % n;
+				while (low < threshold) {
+					m = (next() >> 32) * (uint64_t) n;
+					low = (uint32_t) m;
+				}
+			}
+			return (unsigned int) (m >> 32);
+		}
+
+		/**
+		*	@brief	Uniform real number in [0, 1)
+		*/
+		inline double uniform_double() {
+			return (next() >> 11) * (1.0 / 9007199254740992.0);	// 53 bits / 2^53
+		}
+
+		// Bulk generation (hot loops: draw everything first, then use it)
+		void uniform_ints(unsigned int n, unsigned int* out, size_t count);
+		void uniform_doubles(double* out, size_t count);
+		uint64_t derive_seed(uint64_t stream);
+};
+
+#endif	// RANDOM_ENGINE_H_
@@ -0,0 +1,46 @@
+/**
+ *  @file    RouletteReplacement.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Roulette replacement class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  Replacement operator of the GA (see GAOperators): the new
+ *	generation is drawn from the old one and the offspring,
+ *	one Montecarlo pick at a time, without replacement.
+ *
+ */
+
+#ifndef ROULETTE_REPLACEMENT_H_
+#define ROULETTE_REPLACEMENT_H_
+
+#include <vector>
+#include "FenwickTree.h"
+#include "GAIndividual.h"
+#include "RandomEngine.h"
+
+using namespace std;
+
+class RouletteReplacement {
+	private:
+		// scratch, kept between generations
+		vector<Slot> candidates;	// population + offspring, sorted by fitness
+		vector<int> next_rank;	// candidates not selected yet, as a linked list
+		vector<int> prev_rank;
+		vector<double> rank_weight;
+		vector<double> selection_draws;	// one random number per survivor
+		FenwickTree roulette;
+
+		double selection_weight(const vector<double>& fitness, int rank, int first) const;
+		void update_selection_weight(const vector<double>& fitness, int rank, int first);
+
+	public:
+		void replace(vector<Slot>& population, const vector<Slot>& offspring, \
+					const vector<double>& fitness, unsigned int size, \
+					RandomEngine& rng, vector<Slot>& discarded);
+};
+
+#endif	// ROULETTE_REPLACEMENT_H_
@@ -16,27 +16,78 @@
 #ifndef TSP_PROBLEM_H_
 #define TSP_PROBLEM_H_
 
+#include <cmath>
 #include <cstdlib>
+#include <fstream>
 #include <string>
 #include <vector>
+#include "RandomEngine.h"
 
 using namespace std;
 
 typedef int Node;	// It's an integer, used to distinguish between nodes and indexes
 
+class NeighborLists;
+
 class TSPProblem {
 	private:
-		vector< vector<double> > C;	// costs
+		static const size_t COSTS_ALIGNMENT = 64;	// cache line
+
+		double* C;	// costs: one N*N row-major buffer, C_i,j = C[i*N + j]
+					// (NULL when costs are computed from coordinates)
 		unsigned int N;	// dimension
 		vector<Node> nodes;
 
+		vector<double> X;	// node coordinates (TSPLIB instances only)
+		vector<double> Y;
+
+		void* mapping;	// binary instance mapped in memory (NULL if none)
+		size_t mapping_size;
+
+		bool symmetric;	// C_i,j = C_j,i (and zero diagonal), checked at load time
+
+		vector<double> row_max;	// max_j C_i,j (matrix instances)
+		double min_x, max_x, min_y, max_y;	// bounding box (coordinate instances)
+
+		NeighborLists* neighbor_lists;	// candidates of each node (see build_neighbors())
+		unsigned int threads;	// used to build the neighbor lists (see set_threads())
+
+		void allocate_costs();
+		void load_matrix(fstream& file);
+		void load_coordinates(fstream& file);
+		bool load_binary(const string& filename);
+		bool check_symmetry() const;
+		void compute_cost_bounds();
+
 	public:
-		TSPProblem(unsigned int N);
+		TSPProblem(unsigned int N, uint64_t seed);
 		TSPProblem(string filename);
-		vector< vector<double> > get_costs();
+		~TSPProblem();
+
+		// the cost buffer is owned by the problem: no copies
+		TSPProblem(const TSPProblem&) = delete;
+		TSPProblem& operator=(const TSPProblem&) = delete;
+
+		const double* get_costs() const;
+		inline double cost(Node i, Node j) const {
+			if (C != NULL) { return C[(size_t) i * N + j]; }
+			double dx = X[i] - X[j];
+			double dy = Y[i] - Y[j];
+			return sqrt(dx * dx + dy * dy);
+		}
+		static void distances(const double* x, const double* y, unsigned int n, \
+							double xi, double yi, double* out);
+		double max_cost_from(Node i) const;
+		bool has_coordinates() const;
+		bool is_symmetric() const;
+
+		void set_threads(unsigned int threads);
+		void build_neighbors(unsigned int k);
+		const NeighborLists& get_neighbors() const;
+		void save_binary(const string& filename, bool packed = true) const;
 		void print_costs();
-		unsigned int get_size();
-		vector<Node> get_nodes();
+		unsigned int get_size() const;
+		const vector<Node>& get_nodes() const;
 };
 
 #endif	// TSP_PROBLEM_H_
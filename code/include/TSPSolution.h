@@ -9,6 +9,8 @@
  *  @section DESCRIPTION
  *
  *  This class represents a solution for the TSP problem.
+ *	Along with the path it keeps the position, the successor and
+ *	the predecessor of each node, for O(1) tour queries.
  *
  */
 
@@ -19,6 +21,7 @@
 #include <vector>
 #include <iostream>
 #include "TSPProblem.h"
+#include "TourHash.h"
 
 using namespace std;
 
@@ -27,17 +30,48 @@ class TSPSolution {
 		TSPProblem* problem;
 		vector<Node> path;
 		double solution_cost;
-		Node choose_node(Node from, vector<Node> nodes, vector< vector<double> >& C);
+		uint64_t hash;	// see TourHash
+
+		// tour index, built by the first query that needs it (so not
+		// thread safe) and kept up to date by reverse() from then on
+		mutable bool indexed;
+		mutable vector<unsigned int> position;	// position of each node in the path (node 0: 0)
+		mutable vector<Node> successor;
+		mutable vector<Node> predecessor;
+		void index_path(unsigned int from, unsigned int to) const;
+		inline void check_index() const {
+			if (!this->indexed) { index_path(0, this->problem->get_size()); }
+		}
+
+		static const unsigned int MAX_REJECTIONS = 64;	// see choose_node()
+		static const unsigned int LARGE_TOUR = 5000;	// from here 2-opt works on a TwoLevelList
+		unsigned int choose_node(Node from, const vector<Node>& nodes, RandomEngine& rng);
 
 	public:
 		TSPSolution(TSPProblem* problem, vector<Node> path);
-		TSPSolution(TSPProblem* problem);
+		TSPSolution(TSPProblem* problem, vector<Node> path, double cost);
+		TSPSolution(TSPProblem* problem, RandomEngine& rng);
 		// ~TCPSolution() { problem = nullptr;}
 
+		// Delta evaluation (static versions work on any tour buffer)
+		static double path_cost(TSPProblem* problem, const Node* path, \
+								unsigned int from, unsigned int to);
+		static double reversal_delta(TSPProblem* problem, const Node* path, \
+								unsigned int z, unsigned int t);
+		double segment_cost(unsigned int from, unsigned int to) const;
+		double reversal_delta(unsigned int z, unsigned int t) const;
+
+		double improve(unsigned int neighbors = 8);
+		void reverse(unsigned int z, unsigned int t);
+
 		double get_solution_cost();
-	    vector<Node> get_path();
+		inline uint64_t get_hash() const { return this->hash; }
+	    const vector<Node>& get_path() const;
 	    void print_path();
-	    Node next_node(Node from);
+	    inline Node next_node(Node from) const { check_index(); return this->successor[from]; }
+	    inline Node prev_node(Node from) const { check_index(); return this->predecessor[from]; }
+	    inline unsigned int position_of(Node n) const { check_index(); return this->position[n]; }
+	    bool between(Node a, Node b, Node c) const;
 	    bool equals(TSPSolution& sol);
 };
 
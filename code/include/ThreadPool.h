@@ -0,0 +1,65 @@
+/**
+ *  @file    ThreadPool.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Thread pool class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  A fixed set of worker threads running parallel loops.
+ *	The tasks of a loop are split among the workers' queues;
+ *	a worker that empties its own queue steals from the others.
+ *	The calling thread takes part in the loop as worker 0.
+ *
+ */
+
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+class ThreadPool {
+	private:
+		struct WorkQueue {
+			std::mutex lock;
+			std::deque<unsigned int> tasks;
+		};
+
+		unsigned int workers;
+		vector<std::thread> threads;
+		vector<WorkQueue*> queues;	// one per worker
+
+		std::mutex state_lock;
+		std::condition_variable wake;	// a new loop is available
+		std::condition_variable done;	// all the workers are idle
+		unsigned long epoch;	// number of loops started so far
+		unsigned int busy;	// workers (but the caller) still in the current loop
+		bool stopping;
+		std::function<void(unsigned int, unsigned int)> body;
+
+		void worker_loop(unsigned int worker);
+		void run_tasks(unsigned int worker);
+		bool next_task(unsigned int worker, unsigned int& task);
+
+	public:
+		ThreadPool(unsigned int workers);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		unsigned int size() const;
+		void parallel_for(unsigned int tasks, \
+						std::function<void(unsigned int task, unsigned int worker)> body);
+};
+
+#endif	// THREAD_POOL_H_
@@ -0,0 +1,101 @@
+/**
+ *  @file    TourHash.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Tour hash class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  Zobrist style hash of a tour: the XOR of the keys of its edges.
+ *	On symmetric problems the edges are undirected, so the same tour
+ *	gets the same hash whatever its orientation; on asymmetric ones
+ *	they are directed (see arc()), as a tour and its reverse have
+ *	different costs. A move changes the hash by the keys of the
+ *	edges it removes and adds (XOR again: see key()).
+ *	The key of an edge is a 64-bit mix of its two ends, so no
+ *	N x N table of random keys is stored.
+ *
+ */
+
+#ifndef TOUR_HASH_H_
+#define TOUR_HASH_H_
+
+#include <stdint.h>
+#include "TSPProblem.h"
+
+class TourHash {
+	private:
+		// splitmix64 finalizer
+		static inline uint64_t mix(uint64_t x) {
+			x += 0x9E3779B97F4A7C15ULL;
+			x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+			return x ^ (x >> 31);
+		}
+
+	public:
+		/**
+		*	@brief	Key of the undirected edge (u,v)
+		*
+		*	@return a 64-bit key
+		*/
+		static inline uint64_t edge(Node u, Node v) {
+			return (u < v) ? arc(u, v) : arc(v, u);
+		}
+
+		/**
+		*	@brief	Key of the directed edge from <u> to <v>
+		*
+		*	@return a 64-bit key
+		*/
+		static inline uint64_t arc(Node u, Node v) {
+			return mix(((uint64_t) u << 32) | (uint32_t) v);
+		}
+
+		/**
+		*	@brief	Key of the edge from <u> to <v> in a tour of a
+		*			<symmetric> problem or not
+		*
+		*	@return a 64-bit key
+		*/
+		static inline uint64_t key(Node u, Node v, bool symmetric) {
+			return symmetric ? edge(u, v) : arc(u, v);
+		}
+
+		/**
+		*	@brief	Hash of the tour in <path> (N+1 nodes, 0 at both ends)
+		*			of a <symmetric> problem or not
+		*
+		*	@return the XOR of the keys of its edges
+		*/
+		static inline uint64_t of(const Node* path, unsigned int N, bool symmetric) {
+			uint64_t hash = 0;
+			for (unsigned int i = 0; i < N; i++) {
+				hash ^= key(path[i], path[i + 1], symmetric);
+			}
+			return hash;
+		}
+
+		/**
+		*	@brief	Change of the hash if the sub-path between positions
+		*			<z> and <t> (1 <= z < t < N) of <path> was reversed:
+		*			the two edges at the borders, and on asymmetric
+		*			problems the inner edges, traversed the other way.
+		*
+		*	@return the keys to XOR into the hash
+		*/
+		static inline uint64_t reversal_delta(const Node* path, unsigned int z, unsigned int t, bool symmetric) {
+			uint64_t delta = key(path[z-1], path[z], symmetric) ^ key(path[t], path[t+1], symmetric) \
+							^ key(path[z-1], path[t], symmetric) ^ key(path[z], path[t+1], symmetric);
+			if (!symmetric) {
+				for (unsigned int i = z; i < t; ++i) {
+					delta ^= arc(path[i], path[i+1]) ^ arc(path[i+1], path[i]);
+				}
+			}
+			return delta;
+		}
+};
+
+#endif	// TOUR_HASH_H_
@@ -0,0 +1,75 @@
+/**
+ *  @file    TournamentSelection.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief K-tournament selection class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  Selection operator of the GA (see GAOperators): each call
+ *	picks K distinct individuals uniformly and returns the best.
+ *	Defined here so that it is inlined in the GA loops.
+ *
+ */
+
+#ifndef TOURNAMENT_SELECTION_H_
+#define TOURNAMENT_SELECTION_H_
+
+#include <vector>
+#include <climits>
+#include "GAIndividual.h"
+#include "RandomEngine.h"
+
+using namespace std;
+
+class TournamentSelection {
+	private:
+		vector<unsigned int> order;	// permutation of the population positions
+		vector<unsigned int> swaps;	// swaps to undo
+
+	public:
+		/**
+		*	@brief	Run one K-tournament over <population>.
+		*
+		*	@section DESCRIPTION
+		*	The K candidates are the first K positions of a partial Fisher-Yates
+		*	shuffle of <order>. The swaps are then undone, so the array is the
+		*	same at the start of every tournament (the result depends on the
+		*	random stream only): O(K), no allocations.
+		*
+		*	@return the winner
+		*/
+		inline Slot select(const vector<Slot>& population, const vector<double>& fitness, \
+						unsigned int K, RandomEngine& rng) {
+			unsigned int P = population.size();
+			if (this->order.size() != P) {
+				this->order.resize(P);
+				for (unsigned int i = 0; i < P; i++) { this->order[i] = i; }
+			}
+			this->swaps.resize(K);
+
+			Slot winner = population[this->order[0]];
+			double best_value = INT_MAX;
+			for (unsigned int t = 0; t < K; t++) {
+				unsigned int r = t + rng.uniform_int(P - t);
+				std::swap(this->order[t], this->order[r]);
+				this->swaps[t] = r;
+
+				Slot c = population[this->order[t]];
+				if (fitness[c] < best_value) {
+					best_value = fitness[c];
+					winner = c;
+				}
+			}
+
+			for (unsigned int t = K; t > 0; t--) {
+				std::swap(this->order[t-1], this->order[this->swaps[t-1]]);
+			}
+
+			return winner;
+		}
+};
+
+#endif	// TOURNAMENT_SELECTION_H_
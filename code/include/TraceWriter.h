@@ -0,0 +1,78 @@
+/**
+ *  @file    TraceWriter.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Convergence trace writer class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  Writes one record per GA generation (best, worst and mean fitness,
+ *	diversity, elapsed time) to a binary trace file.
+ *	Records are collected in one buffer while the other one is written
+ *	by a background thread, so the GA never waits for the disk (unless
+ *	a whole buffer is filled before the previous one is written).
+ *	File layout (little endian, see scripts/read_trace.py):
+ *		header: "GATRACE\0", version (u32), problem size (u32),
+ *				population size (u32), record size (u32)
+ *		records: generation (u32), elapsed [ms], best, worst, mean,
+ *				diversity (f64 each)
+ *
+ */
+
+#ifndef TRACE_WRITER_H_
+#define TRACE_WRITER_H_
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+class TraceWriter {
+	public:
+		struct Record {
+			unsigned int generation;
+			double elapsed;	// milliseconds from the start of the run
+			double best;
+			double worst;
+			double mean;
+			double diversity;	// see GAPopulation::get_diversity()
+		};
+
+		static const unsigned int VERSION = 1;
+		static const unsigned int RECORD_SIZE = 4 + 5 * 8;
+
+	private:
+		static const unsigned int BUFFER_RECORDS = 1024;
+
+		ofstream output;
+		vector<char> front;	// filled by the GA
+		vector<char> back;	// written by the background thread
+		bool back_full;
+		bool stopping;
+
+		std::mutex state_lock;
+		std::condition_variable ready;	// the back buffer is full (or stop)
+		std::condition_variable written;	// the back buffer is free again
+		std::thread writer;
+
+		void writer_loop();
+		void flush_front();
+
+	public:
+		TraceWriter(const string& filename, unsigned int problem_size, unsigned int population_size);
+		~TraceWriter();
+
+		TraceWriter(const TraceWriter&) = delete;
+		TraceWriter& operator=(const TraceWriter&) = delete;
+
+		void write(const Record& record);
+		void close();
+};
+
+#endif	// TRACE_WRITER_H_
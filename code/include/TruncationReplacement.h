@@ -0,0 +1,36 @@
+/**
+ *  @file    TruncationReplacement.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Truncation replacement class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  Replacement operator of the GA (see GAOperators): the new
+ *	generation is made of the best individuals among the old
+ *	one and the offspring.
+ *
+ */
+
+#ifndef TRUNCATION_REPLACEMENT_H_
+#define TRUNCATION_REPLACEMENT_H_
+
+#include <vector>
+#include "GAIndividual.h"
+#include "RandomEngine.h"
+
+using namespace std;
+
+class TruncationReplacement {
+	private:
+		vector<Slot> candidates;	// population + offspring (scratch)
+
+	public:
+		void replace(vector<Slot>& population, const vector<Slot>& offspring, \
+					const vector<double>& fitness, unsigned int size, \
+					RandomEngine& rng, vector<Slot>& discarded);
+};
+
+#endif	// TRUNCATION_REPLACEMENT_H_
@@ -0,0 +1,117 @@
+/**
+ *  @file    TwoLevelList.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Two-level doubly-linked list tour class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  A tour as a two-level doubly-linked list: the nodes are split
+ *	into about sqrt(N) segments, each one a doubly-linked list with
+ *	a reversed bit, and the segments are linked in tour order.
+ *	next(), prev() and between() are O(1), reverse() is O(sqrt(N))
+ *	(a flat path needs O(N)): worth it on large instances.
+ *	Tours come in and go out as flat paths (N+1 nodes, node 0 at
+ *	both ends): see load() and store().
+ *
+ */
+
+#ifndef TWO_LEVEL_LIST_H_
+#define TWO_LEVEL_LIST_H_
+
+#include <vector>
+#include "TSPProblem.h"
+
+using namespace std;
+
+class TwoLevelList {
+	private:
+		static const unsigned int MAX_GROWTH = 4;	// rebuild when a segment is this many times too big
+		static const int MAX_ID = 1 << 30;	// rebuild before the node ids overflow
+
+		struct Segment {
+			bool reversed;	// the tour goes through it from last to first
+			Node first;	// node with the lowest id
+			Node last;	// node with the highest id
+			unsigned int size;
+			unsigned int rank;	// order of the segments along the tour (mod S)
+			unsigned int next;	// segments along the tour
+			unsigned int prev;
+		};
+
+		unsigned int N;
+		unsigned int group_size;	// initial size of the segments
+		vector<Segment> segments;
+		vector<unsigned int> parent;	// segment of each node
+		vector<int> id;	// order of the nodes in their segment (consecutive)
+		vector<Node> link_next;	// neighbors as seen from a segment not reversed
+		vector<Node> link_prev;
+		bool unbalanced;	// see rebuild()
+
+		vector<Node> moved;	// scratch: nodes being moved or reversed
+		vector<int> moved_ids;
+		vector<unsigned int> run;	// scratch: segments being reversed
+		vector<Node> order;	// scratch: tour order for rebuild()
+
+		inline Node head(unsigned int s) const {
+			return this->segments[s].reversed ? this->segments[s].last : this->segments[s].first;
+		}
+		inline Node tail(unsigned int s) const {
+			return this->segments[s].reversed ? this->segments[s].first : this->segments[s].last;
+		}
+		// oriented position of <a> in its segment
+		inline int offset(Node a) const {
+			return this->segments[this->parent[a]].reversed ? -this->id[a] : this->id[a];
+		}
+		// whether <a> comes before <b>, starting from the segment of rank 0
+		inline bool before(Node a, Node b) const {
+			unsigned int ra = this->segments[this->parent[a]].rank;
+			unsigned int rb = this->segments[this->parent[b]].rank;
+			return (ra < rb) || ((ra == rb) && (offset(a) < offset(b)));
+		}
+		// make <b> follow <a>
+		inline void set_link(Node a, Node b) {
+			if (this->segments[this->parent[a]].reversed) { this->link_prev[a] = b; } else { this->link_next[a] = b; }
+			if (this->segments[this->parent[b]].reversed) { this->link_next[b] = a; } else { this->link_prev[b] = a; }
+		}
+
+		void split_before(Node a);
+		void split_after(Node b, unsigned int keep_head);
+		void move_to_prev(unsigned int s, Node to);
+		void move_to_next(unsigned int s, Node from);
+		void reverse_inside(Node a, Node b);
+		void reverse_segments(unsigned int first, unsigned int last, unsigned int count);
+		void rebuild();
+
+	public:
+		TwoLevelList();
+
+		void load(const Node* path, unsigned int N);
+		void store(Node* path) const;
+
+		inline Node next(Node a) const {
+			return this->segments[this->parent[a]].reversed ? this->link_prev[a] : this->link_next[a];
+		}
+		inline Node prev(Node a) const {
+			return this->segments[this->parent[a]].reversed ? this->link_next[a] : this->link_prev[a];
+		}
+
+		/**
+		*	@brief	Whether <b> is met going from <a> to <c>
+		*			along the tour, <a> and <c> included
+		*
+		*	@return true if b is between a and c
+		*/
+		inline bool between(Node a, Node b, Node c) const {
+			if (!before(c, a)) {
+				return !before(b, a) && !before(c, b);
+			}
+			return !before(b, a) || !before(c, b);	// the way from a to c wraps around
+		}
+
+		void reverse(Node a, Node b);
+};
+
+#endif	// TWO_LEVEL_LIST_H_
@@ -0,0 +1,29 @@
+/**
+ *  @file    TwoOptSearch.h
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief 2-opt local search class header
+ *
+ *  @section DESCRIPTION
+ *
+ *  A 2-opt local search working in place on a tour buffer
+ *	(see LocalSearch): two edges are replaced by reversing
+ *	the path between them.
+ *	Symmetric problems only (a reversed segment keeps its cost).
+ *
+ */
+
+#ifndef TWO_OPT_SEARCH_H_
+#define TWO_OPT_SEARCH_H_
+
+#include "LocalSearch.h"
+
+class TwoOptSearch : public LocalSearch {
+	private:
+		bool improve_node(Node a, double& delta);
+		void apply_move(unsigned int p, unsigned int q);
+};
+
+#endif	// TWO_OPT_SEARCH_H_
@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+## -*- Mode: python; py-indent-offset: 4; indent-tabs-mode: t; tab-width: 4; coding: utf-8; -*-
+#title           : read_trace.py
+#description     : Read the convergence traces written by the GA (-t option)
+#					and print them as CSV, or a summary of each one.
+#author          : Marco Romanelli
+#date            : 17/10/2026
+#version         : 1
+#usage           : python read_trace.py [-s] <trace.gatrace>...
+#python_version  : 2.7 / 3
+#==============================================================================
+
+
+import getopt, sys
+import struct
+
+
+MAGIC = b"GATRACE\0"
+HEADER = struct.Struct("<8sIIII")	# magic, version, problem size, population size, record size
+RECORD = struct.Struct("<Iddddd")	# generation, elapsed [ms], best, worst, mean, diversity
+FIELDS = ["generation", "elapsed_ms", "best", "worst", "mean", "diversity"]
+
+
+def readTrace(filename):
+	""" Read a trace file and return its header, as a dictionary,
+	and the list of its records (tuples, see FIELDS).
+	"""
+	fp = open(filename, 'rb')
+	data = fp.read()
+	fp.close()
+
+	if len(data) < HEADER.size:
+		raise ValueError("%s: not a trace file" % filename)
+	magic, version, size, population, record_size = HEADER.unpack_from(data, 0)
+	if (magic != MAGIC) or (record_size != RECORD.size):
+		raise ValueError("%s: not a trace file (or a different version)" % filename)
+
+	header = {"version": version, "problem_size": size, "population_size": population}
+
+	records = []
+	offset = HEADER.size
+	while offset + RECORD.size <= len(data):	# a run still writing may leave half a record
+		records.append(RECORD.unpack_from(data, offset))
+		offset += RECORD.size
+
+	return header, records
+
+
+def printCSV(filename, header, records):
+	""" Print the records of a trace as CSV rows (see main() for the header) """
+	for r in records:
+		print(",".join([filename, str(r[0])] + ["%g" % v for v in r[1:]]))
+
+
+def printSummary(filename, header, records):
+	""" Print a one line summary of a trace """
+	if not records:
+		print("%s: N=%d, no generations" % (filename, header["problem_size"]))
+		return
+	first = records[0]
+	last = records[-1]
+	print("%s: N=%d, population %d, %d generations in %.0f ms, best %g -> %g, diversity %.3f -> %.3f" % \
+		(filename, header["problem_size"], header["population_size"], last[0], last[1], \
+		first[2], last[2], first[5], last[5]))
+
+
+def main(argv):
+	try:
+		opts, args = getopt.getopt(argv, "s")
+	except getopt.GetoptError:
+		print("usage: python read_trace.py [-s] <trace.gatrace>...")
+		sys.exit(2)
+
+	summary = ("-s", "") in opts
+	if not args:
+		print("usage: python read_trace.py [-s] <trace.gatrace>...")
+		sys.exit(2)
+
+	if not summary:
+		print(",".join(["trace"] + FIELDS))	# once, for all the traces
+	for filename in args:
+		header, records = readTrace(filename)
+		if summary:
+			printSummary(filename, header, records)
+		else:
+			printCSV(filename, header, records)
+
+
+if __name__ == "__main__":
+	main(sys.argv[1:])
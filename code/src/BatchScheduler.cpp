@@ -0,0 +1,166 @@
+/**
+ *  @file    BatchScheduler.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Batch scheduler class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  Runs a job on a list of instances, several at once
+ *	(see BatchScheduler.h).
+ *
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include "../include/BatchScheduler.h"
+
+using namespace std;
+
+/**
+*	@brief	Constructor: as many workers as jobs of <job_threads>
+*			threads fit in <threads>, at most <max_jobs> (0: no cap),
+*			at least one.
+*/
+BatchScheduler::BatchScheduler(unsigned int threads, unsigned int job_threads, unsigned int max_jobs) {
+	this->workers = std::max(1u, threads / std::max(1u, job_threads));
+	if (max_jobs > 0) {
+		this->workers = std::min(this->workers, max_jobs);
+	}
+	this->next_job = 0;
+	this->waiting = 0;
+}
+
+/**
+*	@brief	Get the number of jobs running at the same time
+*
+*	@return number of workers
+*/
+unsigned int BatchScheduler::get_workers() const {
+	return this->workers;
+}
+
+/**
+*	@brief	Solve all the <instances> with <job>, writing the rows
+*			it returns on <output> (in the order of the instances).
+*			Instances that can't be loaded, or whose job throws,
+*			are reported and get no row.
+*
+*	@return void
+*/
+void BatchScheduler::run(const vector<string>& instances, Job job, ostream& output) {
+	unsigned int n = instances.size();
+	this->instances = instances;
+	this->problems.assign(n, NULL);
+	this->errors.assign(n, "");
+	this->rows.assign(n, "");
+	this->loaded.assign(n, 0);
+	this->done.assign(n, 0);
+	this->next_job = 0;
+	this->waiting = 0;
+
+	std::thread loader(&BatchScheduler::load_instances, this);
+	vector<std::thread> threads;
+	for (unsigned int w = 0; w < std::min(this->workers, n); w++) {
+		threads.push_back(std::thread(&BatchScheduler::run_jobs, this, job));
+	}
+
+	// rows in order, as soon as they are ready
+	for (unsigned int i = 0; i < n; i++) {
+		string row;
+		{
+			std::unique_lock<std::mutex> guard(this->state_lock);
+			this->job_done.wait(guard, [&] { return this->done[i] != 0; });
+			row.swap(this->rows[i]);
+		}
+		if (!row.empty()) {
+			output << row << "\r\n" << std::flush;
+		}
+	}
+
+	loader.join();
+	for (auto& t : threads) { t.join(); }
+}
+
+/**
+*	@brief	Loader thread: load the instances in order, waiting while
+*			every worker has an instance ready.
+*
+*	@return void
+*/
+void BatchScheduler::load_instances() {
+	for (unsigned int i = 0; i < this->instances.size(); i++) {
+		{
+			std::unique_lock<std::mutex> guard(this->state_lock);
+			this->load_slot.wait(guard, [&] { return this->waiting < this->workers; });
+		}
+
+		TSPProblem* problem = NULL;
+		string error;
+		try {
+			problem = new TSPProblem(this->instances[i]);
+		} catch(std::exception& e) {
+			error = e.what();
+		}
+
+		{
+			std::lock_guard<std::mutex> guard(this->state_lock);
+			this->problems[i] = problem;
+			this->errors[i] = error;
+			this->loaded[i] = 1;
+			this->waiting++;
+		}
+		this->job_loaded.notify_all();
+	}
+}
+
+/**
+*	@brief	Worker thread: solve the next instance, until none is left
+*
+*	@return void
+*/
+void BatchScheduler::run_jobs(Job job) {
+	while (true) {
+		unsigned int i;
+		TSPProblem* problem;
+		string error;
+		{
+			std::unique_lock<std::mutex> guard(this->state_lock);
+			if (this->next_job >= this->instances.size()) { return; }
+			i = this->next_job++;
+			this->job_loaded.wait(guard, [&] { return this->loaded[i] != 0; });
+			problem = this->problems[i];
+			this->problems[i] = NULL;
+			error = this->errors[i];
+			this->waiting--;
+
+			if (problem != NULL) {
+				cout << "Now running on: \'" << this->instances[i] << "\'..." << endl;
+			} else {
+				std::cout << "[!] EXCEPTION: " << error << std::endl;
+			}
+		}
+		this->load_slot.notify_one();
+
+		string row;
+		if (problem != NULL) {
+			try {
+				row = job(this->instances[i], problem);
+			} catch(std::exception& e) {
+				std::lock_guard<std::mutex> guard(this->state_lock);
+				std::cout << "[!] EXCEPTION: " << e.what() << std::endl;
+			}
+			delete problem;
+		}
+
+		{
+			std::lock_guard<std::mutex> guard(this->state_lock);
+			this->rows[i] = row;
+			this->done[i] = 1;
+		}
+		this->job_done.notify_all();
+	}
+}
@@ -57,8 +57,7 @@ using namespace std;
 	int created_vars = 0;	// total number of variables used in cplex
 
 	unsigned int N = problem->get_size();
-	vector< Node > nodes = problem->get_nodes();
-	vector< vector<double> > C = problem->get_costs();
+	const vector< Node >& nodes = problem->get_nodes();
 
 	xMap.resize(N);	// variables: x_i,j
 	for (unsigned int i = 0; i < N; i++) {
@@ -94,7 +93,7 @@ using namespace std;
 		 if (i == j) continue;	// skip same indexes
 
 		 char ytype = 'B';
-		 double obj = C[i][j];	// coefficient of object function
+		 double obj = problem->cost(i, j);	// coefficient of object function
 		 double lb = 0.0;
 		 double ub = CPX_INFBOUND;
 		 snprintf(name, NAME_SIZE, "y_%d,%d", nodes[i], nodes[j]);
@@ -240,6 +239,24 @@ using namespace std;
 	 CPXsetdblparam(env, CPX_PARAM_TILIM, time_limit);	// Setup time limit
  }
 
+ /**
+ *	@brief	Destructor: free the model and the enviroment
+ *			(and so the CPLEX license)
+ */
+ CPLEXSolver::~CPLEXSolver() {
+	 CPXfreeprob(env, &lp);
+	 CPXcloseCPLEX(&env);
+ }
+
+ /**
+ *	@brief	Limit the threads used by CPLEX (0: as many as it likes)
+ *
+ *	@return void
+ */
+ void CPLEXSolver::set_threads(unsigned int threads) {
+	 CHECKED_CPX_CALL( CPXsetintparam, env, CPX_PARAM_THREADS, threads );
+ }
+
  /**
  *	@brief	main function: solves the model and prints it in a file
  *
@@ -270,26 +287,32 @@ using namespace std;
  }
 
  /**
- *	@brief	compute the optimum path
+ *	@brief	compute the optimum path: from node 0, follow the
+ *			y_i,j set to 1 (one pass, N+1 nodes)
  *
  *	@return return a list (vector) of nodes
  */
- vector<Node> CPLEXSolver::extract_path(vector<double> vals, int start, int cnt){
-	 int l = problem->get_size() + 1;	// starting node should be consider twice
-
-	 if (cnt == l) { return vector<Node>(); }
-
-	 for (int i = 0; i < l; ++i) {	// i: current node
-		 if ( i != start && round(vals[yMap[start][i] ]) == 1) {
-			 vector<Node> res;
-			 res.push_back(start);
-			 vector<Node> next_path = extract_path(vals, i, ++cnt);
-
-			 // append the remaining path
-			 res.insert(res.end(), next_path.begin(), next_path.end());
-			 return res;
+ vector<Node> CPLEXSolver::extract_path(const vector<double>& vals){
+	 unsigned int N = problem->get_size();
+	 vector<Node> path;
+	 path.reserve(N + 1);
+
+	 Node current = 0;	// starting node should be consider twice
+	 path.push_back(current);
+	 for (unsigned int k = 0; k < N; ++k) {
+		 Node next = -1;
+		 for (unsigned int j = 0; j < N; ++j) {
+			 int y = yMap[current][j];
+			 if ((y >= 0) && (round(vals[y]) == 1)) {
+				 next = j;
+				 break;
+			 }
 		 }
+		 if (next < 0) { break; }	// not a tour
+
+		 path.push_back(next);
+		 current = next;
 	 }
 
-	 return vector<Node>();
+	 return path;
  }
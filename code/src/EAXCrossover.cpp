@@ -0,0 +1,320 @@
+/**
+ *  @file    EAXCrossover.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Edge assembly crossover class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  Edge assembly crossover (EAX, single AB-cycle version)
+ *	on adjacency arrays.
+ *
+ */
+
+#include <assert.h>
+#include <limits>
+#include "../include/EAXCrossover.h"
+#include "../include/NeighborLists.h"
+
+using namespace std;
+
+/**
+*	@brief	Default contructor (buffers are sized at the first use)
+*/
+EAXCrossover::EAXCrossover() {
+	this->problem = NULL;
+	this->N = 0;
+}
+
+/**
+*	@brief	Build the neighbor lists used to join the subtours
+*			(not thread safe: call it before sharing the problem)
+*
+*	@return void
+*/
+void EAXCrossover::prepare(TSPProblem* problem, unsigned int neighbors) {
+	problem->build_neighbors(neighbors);
+}
+
+/**
+*	@brief	Create a child of <p1> (with cost <p1_cost>) and <p2>
+*			into <child> (all tours of N+1 nodes, 0 at both ends).
+*			The nodes whose edges changed are put in <changed>.
+*			Requires the neighbor lists of the problem.
+*
+*	@return the cost of the child
+*/
+double EAXCrossover::cross(TSPProblem* problem, const Node* p1, double p1_cost, const Node* p2, \
+						Node* child, RandomEngine& rng, vector<Node>& changed) {
+	this->problem = problem;
+	this->N = problem->get_size();
+	this->adj_a.resize(2 * this->N);
+	this->adj_b.resize(2 * this->N);
+
+	load_adjacency(p1, this->adj_a);
+	load_adjacency(p2, this->adj_b);
+	build_ab_cycles(rng);
+	changed.clear();
+
+	unsigned int cycles = this->cycle_start.size() - 1;
+	if (cycles == 0) {	// same tour
+		std::copy(p1, p1 + this->N + 1, child);
+		return p1_cost;
+	}
+
+	// A with the A-edges of one AB-cycle replaced by its B-edges
+	// (all the removals first: a node can be crossed more than once)
+	unsigned int c = rng.uniform_int(cycles);
+	unsigned int first = this->cycle_start[c];
+	unsigned int last = this->cycle_start[c + 1] - 1;	// the start node, again
+
+	this->adj_child = this->adj_a;
+	double delta = 0;
+	for (unsigned int i = first; i < last; i += 2) {
+		unlink(this->adj_child, this->cycle_nodes[i], this->cycle_nodes[i + 1]);
+		delta -= this->problem->cost(this->cycle_nodes[i], this->cycle_nodes[i + 1]);
+	}
+	for (unsigned int i = first + 1; i < last; i += 2) {
+		link(this->adj_child, this->cycle_nodes[i], this->cycle_nodes[i + 1]);
+		delta += this->problem->cost(this->cycle_nodes[i], this->cycle_nodes[i + 1]);
+	}
+	changed.assign(this->cycle_nodes.begin() + first, this->cycle_nodes.begin() + last);
+
+	delta += merge_subtours(changed);
+
+	// back to a path starting from 0
+	Node prev = -1;
+	Node cur = 0;
+	child[0] = 0;
+	for (unsigned int i = 1; i < this->N; i++) {
+		Node next = next_in_child(cur, prev);
+		child[i] = next;
+		prev = cur;
+		cur = next;
+	}
+	child[this->N] = 0;
+
+	return p1_cost + delta;
+}
+
+/**
+*	@brief	Fill <adj> with the two neighbors of each node in <path>
+*
+*	@return void
+*/
+void EAXCrossover::load_adjacency(const Node* path, vector<Node>& adj) {
+	for (unsigned int i = 0; i < this->N; i++) {
+		adj[2 * path[i] + 1] = path[i + 1];
+		adj[2 * path[i + 1]] = path[i];
+	}
+}
+
+/**
+*	@brief	Remove edge (u,v) from <adj>
+*
+*	@return void
+*/
+void EAXCrossover::unlink(vector<Node>& adj, Node u, Node v) {
+	adj[(adj[2*u] == v) ? 2*u : 2*u + 1] = -1;
+	adj[(adj[2*v] == u) ? 2*v : 2*v + 1] = -1;
+}
+
+/**
+*	@brief	Add edge (u,v) to <adj> (u and v have a free slot)
+*
+*	@return void
+*/
+void EAXCrossover::link(vector<Node>& adj, Node u, Node v) {
+	adj[(adj[2*u] == -1) ? 2*u : 2*u + 1] = v;
+	adj[(adj[2*v] == -1) ? 2*v : 2*v + 1] = u;
+}
+
+/**
+*	@brief	Split the edges that are only in A or only in B into
+*			AB-cycles, choosing randomly where there is a choice.
+*
+*	@section DESCRIPTION
+*	Every node has as many A-only edges as B-only edges, so a walk
+*	leaving s with an A-edge and then alternating B- and A-edges
+*	can always go on, until it gets back to s with a B-edge.
+*	(The walk can cross a node twice: a closed trail rather than a
+*	simple cycle, which is fine to exchange edges.)
+*
+*	@return void
+*/
+void EAXCrossover::build_ab_cycles(RandomEngine& rng) {
+	unsigned int N = this->N;
+	this->free_a.resize(2 * N);
+	this->free_b.resize(2 * N);
+	this->count_a.assign(N, 0);
+	this->count_b.assign(N, 0);
+
+	for (unsigned int v = 0; v < N; v++) {
+		for (int k = 0; k < 2; k++) {
+			Node w = this->adj_a[2*v + k];
+			if ((w != this->adj_b[2*v]) && (w != this->adj_b[2*v + 1])) {
+				this->free_a[2*v + this->count_a[v]++] = w;
+			}
+			w = this->adj_b[2*v + k];
+			if ((w != this->adj_a[2*v]) && (w != this->adj_a[2*v + 1])) {
+				this->free_b[2*v + this->count_b[v]++] = w;
+			}
+		}
+	}
+
+	this->cycle_nodes.clear();
+	this->cycle_start.assign(1, 0);
+
+	unsigned int offset = rng.uniform_int(N);
+	for (unsigned int k = 0; k < N; k++) {
+		Node s = (offset + k) % N;
+		while (this->count_a[s] > 0) {
+			Node cur = s;
+			bool a_turn = true;
+			this->cycle_nodes.push_back(s);
+			do {
+				vector<Node>& edges = a_turn ? this->free_a : this->free_b;
+				vector<unsigned char>& count = a_turn ? this->count_a : this->count_b;
+
+				// take edge (cur, w) and drop it from both ends
+				unsigned int pick = (count[cur] == 2) ? rng.uniform_int(2) : 0;
+				Node w = edges[2*cur + pick];
+				edges[2*cur + pick] = edges[2*cur + count[cur] - 1];
+				count[cur]--;
+				unsigned int back = (edges[2*w] == cur) ? 0 : 1;
+				edges[2*w + back] = edges[2*w + count[w] - 1];
+				count[w]--;
+
+				this->cycle_nodes.push_back(w);
+				cur = w;
+				a_turn = !a_turn;
+			} while ((cur != s) || !a_turn);
+			this->cycle_start.push_back(this->cycle_nodes.size());
+		}
+	}
+}
+
+/**
+*	@brief	Join the subtours of the child, smallest first, each one
+*			with the cheapest 2-opt style exchange with another one.
+*
+*	@return the change of the cost of the child
+*/
+double EAXCrossover::merge_subtours(vector<Node>& changed) {
+	unsigned int N = this->N;
+	this->subtour.assign(N, -1);
+	this->subtour_size.clear();
+	this->subtour_first.clear();
+
+	for (unsigned int v = 0; v < N; v++) {
+		if (this->subtour[v] >= 0) { continue; }
+		int id = this->subtour_size.size();
+		unsigned int size = 0;
+		Node prev = -1;
+		Node cur = v;
+		do {
+			this->subtour[cur] = id;
+			size++;
+			Node next = next_in_child(cur, prev);
+			prev = cur;
+			cur = next;
+		} while (cur != (Node) v);
+		this->subtour_size.push_back(size);
+		this->subtour_first.push_back(v);
+	}
+
+	double delta = 0;
+	for (unsigned int left = this->subtour_size.size(); left > 1; left--) {
+		int smallest = -1;
+		for (unsigned int s = 0; s < this->subtour_size.size(); s++) {
+			if ((this->subtour_size[s] > 0) && \
+				((smallest < 0) || (this->subtour_size[s] < this->subtour_size[smallest]))) {
+				smallest = s;
+			}
+		}
+		delta += merge_into_neighbor(smallest, changed);
+	}
+	return delta;
+}
+
+/**
+*	@brief	Join subtour <s> to another one: edges (u,u2) of s and
+*			(v,v2) of the other are replaced by (u,v),(u2,v2) or by
+*			(u,v2),(u2,v), v being a neighbor of u. If no node of s has
+*			a neighbor outside, every node outside is tried.
+*
+*	@return the change of the cost of the child
+*/
+double EAXCrossover::merge_into_neighbor(int s, vector<Node>& changed) {
+	const NeighborLists& neighbors = this->problem->get_neighbors();
+	double best = std::numeric_limits<double>::infinity();
+	Node best_u = -1, best_u2 = -1, best_v = -1, best_v2 = -1;
+	bool crossed = false;
+
+	auto consider = [&](Node u, Node v) {
+		if (this->subtour[v] == s) { return; }
+		for (int a = 0; a < 2; a++) {
+			Node u2 = this->adj_child[2*u + a];
+			for (int b = 0; b < 2; b++) {
+				Node v2 = this->adj_child[2*v + b];
+				double removed = this->problem->cost(u, u2) + this->problem->cost(v, v2);
+				double straight = this->problem->cost(u, v) + this->problem->cost(u2, v2) - removed;
+				double twisted = this->problem->cost(u, v2) + this->problem->cost(u2, v) - removed;
+				if ((straight < best) || (twisted < best)) {
+					best = std::min(straight, twisted);
+					crossed = (twisted < straight);
+					best_u = u;
+					best_u2 = u2;
+					best_v = v;
+					best_v2 = v2;
+				}
+			}
+		}
+	};
+
+	for (int pass = 0; (pass < 2) && (best_u < 0); pass++) {
+		Node prev = -1;
+		Node u = this->subtour_first[s];
+		do {
+			if (pass == 0) {
+				for (const Node* it = neighbors.begin(u); it != neighbors.end(u); ++it) {
+					consider(u, *it);
+				}
+			} else {
+				for (Node v = 0; v < (Node) this->N; v++) {
+					consider(u, v);
+				}
+			}
+			Node next = next_in_child(u, prev);
+			prev = u;
+			u = next;
+		} while (u != this->subtour_first[s]);
+	}
+	assert(best_u >= 0);
+
+	// s becomes part of the other subtour
+	int target = this->subtour[best_v];
+	Node prev = -1;
+	Node u = this->subtour_first[s];
+	do {
+		this->subtour[u] = target;
+		Node next = next_in_child(u, prev);
+		prev = u;
+		u = next;
+	} while (u != this->subtour_first[s]);
+	this->subtour_size[target] += this->subtour_size[s];
+	this->subtour_size[s] = 0;
+
+	unlink(this->adj_child, best_u, best_u2);
+	unlink(this->adj_child, best_v, best_v2);
+	link(this->adj_child, best_u, crossed ? best_v2 : best_v);
+	link(this->adj_child, best_u2, crossed ? best_v : best_v2);
+
+	changed.push_back(best_u);
+	changed.push_back(best_u2);
+	changed.push_back(best_v);
+	changed.push_back(best_v2);
+	return best;
+}
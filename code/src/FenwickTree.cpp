@@ -0,0 +1,88 @@
+/**
+ *  @file    FenwickTree.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Fenwick tree class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  A Fenwick (binary indexed) tree over a vector of non negative
+ *	weights: point updates, total and roulette-wheel search
+ *	in O(log n).
+ *
+ */
+
+#include "../include/FenwickTree.h"
+
+using namespace std;
+
+/**
+*	@brief	Default contructor (empty tree)
+*/
+FenwickTree::FenwickTree() {
+	this->size = 0;
+	this->top_bit = 0;
+}
+
+/**
+*	@brief	Build the tree over the given weights in O(n).
+*			The memory is reused between calls.
+*
+*	@return void
+*/
+void FenwickTree::reset(const vector<double>& weights) {
+	this->size = weights.size();
+	this->tree.assign(this->size + 1, 0);
+
+	for (unsigned int i = 1; i <= this->size; ++i) {
+		this->tree[i] += weights[i-1];
+		unsigned int parent = i + (i & (~i + 1));
+		if (parent <= this->size) { this->tree[parent] += this->tree[i]; }
+	}
+
+	this->top_bit = 1;
+	while ((this->top_bit << 1) <= this->size) { this->top_bit <<= 1; }
+}
+
+/**
+*	@brief	Add <delta> to the weight of element i
+*
+*	@return void
+*/
+void FenwickTree::add(unsigned int i, double delta) {
+	for (++i; i <= this->size; i += i & (~i + 1)) {
+		this->tree[i] += delta;
+	}
+}
+
+/**
+*	@brief	Sum of all the weights
+*
+*	@return total weight
+*/
+double FenwickTree::total() const {
+	double sum = 0;
+	for (unsigned int i = this->size; i > 0; i -= i & (~i + 1)) {
+		sum += this->tree[i];
+	}
+	return sum;
+}
+
+/**
+*	@brief	Roulette wheel: find the first element whose cumulative
+*			weight is greater than <value> (0 <= value < total()).
+*
+*	@return index of the element (size() if value >= total())
+*/
+unsigned int FenwickTree::find(double value) const {
+	unsigned int pos = 0;
+	for (unsigned int step = this->top_bit; step > 0; step >>= 1) {
+		if ((pos + step <= this->size) && (this->tree[pos + step] <= value)) {
+			pos += step;
+			value -= this->tree[pos];
+		}
+	}
+	return pos;
+}
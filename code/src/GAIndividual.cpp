@@ -22,8 +22,9 @@ using namespace std;
 /**
 *	@brief	Default contructor
 */
-GAIndividual::GAIndividual(TSPProblem *problem): TSPSolution(problem) {}
+GAIndividual::GAIndividual(TSPProblem *problem, RandomEngine& rng): TSPSolution(problem, rng) {}
 GAIndividual::GAIndividual(TSPProblem *problem, vector<Node> p): TSPSolution(problem, p) {}
+GAIndividual::GAIndividual(TSPProblem *problem, vector<Node> p, double fitness): TSPSolution(problem, p, fitness) {}
 
 /**
 *   @brief	function to get access to the sol. cost. value,
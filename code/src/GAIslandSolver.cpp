@@ -0,0 +1,249 @@
+/**
+ *  @file    GAIslandSolver.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief GA island model solver class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  This class represents a solver for the TSP problem
+ *	using a genetic algorithm with an island model:
+ *	several populations evolve independently, each one on its
+ *	own thread, and from time to time send their best
+ *	individuals to other islands (migration).
+ *	Migrants travel through lock-free queues: no island ever
+ *	waits for another.
+ *
+ */
+
+#include "../include/GAIslandSolver.h"
+#include <iostream>
+#include <thread>
+#include <sys/time.h>
+#include <math.h>
+
+using namespace std;
+
+/**
+*	@brief	Default constructor.
+*			The population (problem-size * pop_size_factor individuals)
+*			is split among the islands.
+*/
+template <class Operators>
+GAIslandSolver<Operators>::GAIslandSolver(TSPProblem *problem, unsigned int pop_size_factor, \
+		unsigned int t_limit, unsigned int itr_limit,
+		double mutation_pr,
+		unsigned int n_islands,
+		MigrationTopology topology,
+		bool vvv,
+		uint64_t seed) {
+	this->problem = problem;
+	this->islands = (n_islands > 0) ? n_islands : 1;
+	this->population_size = std::max(2u, problem->get_size() * pop_size_factor / this->islands);
+	this->time_limit = (long long) t_limit * 1000;	// seconds to milliseconds
+	this->iterations_limit = itr_limit;
+	this->mutation_probability = mutation_pr;
+	this->verbose = vvv;
+	this->local_search_budget = 0;
+	this->polish = false;
+	this->seeds.seed(seed);
+
+	this->topology = topology;
+	this->migration_interval = 25;	// Fixed!
+	this->migrants = 2;	// Fixed!
+}
+
+/**
+*	@brief	Improve every child with 2-opt moves, examining at most
+*			<budget> nodes each (see GAPopulation::enable_local_search())
+*
+*	@return void
+*/
+template <class Operators>
+void GAIslandSolver<Operators>::set_local_search(unsigned int budget) {
+	this->local_search_budget = budget;
+}
+
+/**
+*	@brief	Improve the best tour found with 2-opt and Or-opt
+*			before returning it (see TSPSolution::improve())
+*
+*	@return void
+*/
+template <class Operators>
+void GAIslandSolver<Operators>::set_polish(bool polish) {
+	this->polish = polish;
+}
+
+/**
+*	@brief	Main function: solve the problem running all the islands
+*			in parallel, then pick the best individual among them.
+*/
+template <class Operators>
+GAIndividual* GAIslandSolver<Operators>::solve() {
+	unsigned int tour_length = this->problem->get_size() + 1;
+
+	// shared by the islands: build what they need once, now
+	Operators::Crossover::prepare(this->problem);
+	if (this->local_search_budget > 0) {
+		this->problem->build_neighbors(8);
+	}
+
+	this->populations.assign(this->islands, NULL);
+	this->generations.assign(this->islands, 0);
+	this->inboxes.clear();
+	for (unsigned int i = 0; i < this->islands; i++) {
+		this->inboxes.push_back(new MigrationQueue(INBOX_CAPACITY, tour_length));
+	}
+
+	// Start all the islands (no barrier: each one stops on its own)
+	long long t_start = current_timestamp();	// time in milliseconds
+	vector< std::thread > threads;
+	for (unsigned int i = 0; i < this->islands; i++) {
+		threads.push_back(std::thread(&GAIslandSolver::run_island, this, i, t_start));
+	}
+	for (auto & t : threads) { t.join(); }
+
+	// Best individual over all the islands
+	unsigned int best_island = 0;
+	for (unsigned int i = 0; i < this->islands; i++) {
+		if (this->verbose) {
+			cout << " Island " << i << " (generations: " << this->generations[i] \
+				<< "): Worst " << this->populations[i]->get_worst_fitness() \
+				<< ", Best: " << this->populations[i]->get_best_fitness() << endl;
+		}
+
+		if (this->populations[i]->get_best_fitness() < this->populations[best_island]->get_best_fitness()) {
+			best_island = i;
+		}
+	}
+
+	GAIndividual* best_individual = this->populations[best_island]->get_best_individual();
+	for (unsigned int i = 0; i < this->islands; i++) {
+		delete this->populations[i];
+		delete this->inboxes[i];
+	}
+	this->populations.clear();
+	this->inboxes.clear();
+
+	if (this->polish) {
+		best_individual->improve();
+		if (this->verbose) {
+			cout << " Polished: " << best_individual->get_solution_cost() << endl;
+		}
+	}
+
+	return best_individual;
+}
+
+/**
+*	@brief	Evolve one island (runs on its own thread):
+*			the same loop of GASolver::solve(), plus migrations.
+*
+*	@return void
+*/
+template <class Operators>
+void GAIslandSolver<Operators>::run_island(unsigned int island, long long t_start) {
+	// used to choose where migrants go
+	RandomEngine rng(this->seeds.derive_seed(2 * island + 1));
+
+	// Phase 1: create the first population
+	GAPopulation<Operators>* population = new GAPopulation<Operators>(this->population_size,\
+											this->mutation_probability, \
+											this->problem, \
+											this->seeds.derive_seed(2 * island));
+	population->enable_local_search(this->local_search_budget);
+	this->populations[island] = population;
+
+	// Counting how much consegutive iterations
+	// the population fitness fits to a value.
+	unsigned int fix_point = 0;
+	// If a fix point is reached for <fix_point_limit>
+	// consegutive iterations stop evolution
+	unsigned int fix_point_limit = pow(this->problem->get_size(), 1.3);
+
+	unsigned int i = 0;	// current itereation
+	while  ((i < this->iterations_limit) && ((current_timestamp() - t_start) < this->time_limit)) {
+		// Phase 2: select the mating pool
+		vector< Slot > mating_pool = population->create_mating_pool(20);
+
+		// Phase 3-4: crossover to generate offsprings
+		// and mutate new children according to probability
+		vector< Slot > offsprings = population->crossover(mating_pool);
+
+		// Phase 5: population management
+		population->population_management(offsprings);
+
+		// Phase 6: exchange individuals with the other islands
+		if ((this->islands > 1) && ((i + 1) % this->migration_interval == 0)) {
+			migrate(island, rng);
+		}
+
+		// Check for fix point
+		double best = population->get_best_fitness();
+		double worst = population->get_worst_fitness();
+		if ( worst == best ) { fix_point++; } else { fix_point = 0; }
+
+		// If fix point counter reaches a fixed value stop evolution
+		if ( fix_point > fix_point_limit) { break; }
+
+		i++;
+	}
+
+	this->generations[island] = i;
+}
+
+/**
+*	@brief	Send the best individuals of an island to the next one
+*			(according to the topology) and welcome the migrants
+*			waiting in its inbox. Never blocks: if the destination
+*			inbox is full the migrants are dropped.
+*
+*	@return void
+*/
+template <class Operators>
+void GAIslandSolver<Operators>::migrate(unsigned int island, RandomEngine& rng) {
+	GAPopulation<Operators>* population = this->populations[island];
+
+	// Emigration
+	unsigned int destination;
+	if (this->topology == RING) {
+		destination = (island + 1) % this->islands;
+	} else {
+		destination = rng.uniform_int(this->islands - 1);
+		if (destination >= island) { destination++; }
+	}
+
+	vector< Slot > elite = population->get_elite(this->migrants);
+	for (auto & s : elite) {
+		this->inboxes[destination]->push(population->get_tour(s), population->get_fitness(s));
+	}
+
+	// Immigration
+	vector< Node > tour(this->problem->get_size() + 1);
+	double tour_fitness;
+	while (this->inboxes[island]->pop(&tour[0], tour_fitness)) {
+		population->replace_worst(&tour[0], tour_fitness);
+	}
+}
+
+/**
+*	@brief	Get time in milliseconds
+*
+*	@return return time [milliseconds]
+*/
+template <class Operators>
+long long GAIslandSolver<Operators>::current_timestamp() {
+    struct timeval te;
+    gettimeofday(&te, NULL);	// get current time
+    long long milliseconds = te.tv_sec*1000LL + te.tv_usec/1000;	// caculate milliseconds
+    return milliseconds;
+}
+
+// Configurations compiled in (see GAOperators.h)
+template class GAIslandSolver<OrderRouletteGA>;
+template class GAIslandSolver<OrderTruncationGA>;
+template class GAIslandSolver<EAXRouletteGA>;
+template class GAIslandSolver<EAXTruncationGA>;
@@ -15,7 +15,8 @@
 
 #include <assert.h>
 #include <algorithm>
-#include <climits>
+#include <cmath>
+#include <numeric>
 #include "../include/GAPopulation.h"
 
 using namespace std;
@@ -23,22 +24,126 @@ using namespace std;
 /**
 *	@brief	Default contructor
 */
-GAPopulation::GAPopulation(unsigned int size, double mutation_probability, TSPProblem *problem) {
+template <class Operators>
+GAPopulation<Operators>::GAPopulation(unsigned int size, double mutation_probability, TSPProblem *problem, \
+						uint64_t seed, ThreadPool* workers) {
 	// Store parameters
 	this->population_size = size;
 	this->problem = problem;
 	this->new_generation_ratio = 2;	// Fixed!
 	this->mutation_probability = mutation_probability;
-
-	// Populate the population (= set of individuals)
+	this->workers = workers;
+	this->workspaces.resize((workers != NULL) ? workers->size() : 1);
+	this->rng.seed(seed);
+	this->local_search_budget = 0;
+	this->profiler = NULL;
+	Crossover::prepare(problem);
+
+	// Make room for the population and for one offspring
+	// (one child every <new_generation_ratio> parents)
+	this->tour_length = problem->get_size() + 1;
+	unsigned int slots = this->population_size * 2;
+	this->tours.resize((size_t) slots * this->tour_length);
+	this->fitness.resize(slots);
+	this->hashes.resize(slots);
+	this->free_slots.reserve(slots);
+	for (Slot s = slots; s > 0; --s) { this->free_slots.push_back(s-1); }
+
+	// Populate the population (= set of individuals), in parallel
 	for (unsigned int i = 0; i < this->population_size; ++i) {
-		this->population.push_back(new GAIndividual(this->problem));
+		this->population.push_back(acquire_slot());
+	}
+	run_chunks(this->population_size, [&](unsigned int from, unsigned int to, Workspace& ws) {
+		for (unsigned int i = from; i < to; ++i) {
+			TSPSolution individual(this->problem, ws.rng);
+			const vector<Node>& path = individual.get_path();
+
+			Slot s = this->population[i];
+			std::copy(path.begin(), path.end(), get_tour(s));
+			this->fitness[s] = individual.get_solution_cost();
+			this->hashes[s] = individual.get_hash();
+		}
+	});
+	index_population();
+}
+
+/**
+*	@brief	Get a free slot of the pool for a new individual.
+*			If there is none, the pool grows.
+*
+*	@return a slot
+*/
+template <class Operators>
+Slot GAPopulation<Operators>::acquire_slot() {
+	if (this->free_slots.empty()) {
+		Slot s = this->fitness.size();
+		this->tours.resize(this->tours.size() + this->tour_length);
+		this->fitness.push_back(0);
+		this->hashes.push_back(0);
+		return s;
 	}
+
+	Slot s = this->free_slots.back();
+	this->free_slots.pop_back();
+	return s;
+}
+
+/**
+*	@brief	Give back a slot of the pool (the individual is discarded)
+*
+*	@return void
+*/
+template <class Operators>
+void GAPopulation<Operators>::release_slot(Slot s) {
+	this->free_slots.push_back(s);
 }
 
 /**
-*	@brief	Create a mating pool based on the mathod called K-tournament.
-*			K is set to <ratio>% of population-size;
+*	@brief	Run body(from, to, workspace) over [0, items) in chunks of
+*			CHUNK_SIZE, in parallel when a thread pool is available.
+*
+*	@section DESCRIPTION
+*	Before running a chunk, the random engine of the workspace is
+*	seeded with (generation seed, chunk number): what a chunk produces
+*	does not depend on which thread runs it or when, so a run is
+*	deterministic for a given seed. The generation seed is the next
+*	number of the population engine.
+*
+*	@return void
+*/
+template <class Operators>
+void GAPopulation<Operators>::run_chunks(unsigned int items, \
+							std::function<void(unsigned int, unsigned int, Workspace&)> body) {
+	uint64_t seed = this->rng.next();
+	unsigned int chunks = (items + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+	auto chunk = [&](unsigned int c, unsigned int worker) {
+		Workspace& ws = this->workspaces[worker];
+		ws.rng.seed(seed, c);
+#ifdef GA_PROFILE
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		unsigned long allocations = GAProfiler::thread_allocations();
+#endif
+		body(c * CHUNK_SIZE, std::min(items, (c + 1) * CHUNK_SIZE), ws);
+#ifdef GA_PROFILE
+		if (this->profiler != NULL) {
+			this->profiler->add_worker(worker, std::chrono::duration_cast<std::chrono::nanoseconds>( \
+									std::chrono::steady_clock::now() - start).count(), \
+									GAProfiler::thread_allocations() - allocations);
+		}
+#endif
+	};
+
+	if (this->workers != NULL) {
+		this->workers->parallel_for(chunks, chunk);
+	} else {
+		for (unsigned int c = 0; c < chunks; c++) { chunk(c, 0); }
+	}
+}
+
+/**
+*	@brief	Create a mating pool with the selection operator
+*			(K-tournament). K is set to <ratio>% of population-size;
 *
 *	@section DESCRIPTION
 *	Each individual is selected by choosing uniformly n individuals (2<=k<=N)
@@ -46,34 +151,25 @@ GAPopulation::GAPopulation(unsigned int size, double mutation_probability, TSPPr
 *
 *	@return set of individuals
 */
-vector< GAIndividual* > GAPopulation::create_mating_pool(unsigned int ratio) {
+template <class Operators>
+vector< Slot > GAPopulation<Operators>::create_mating_pool(unsigned int ratio) {
 	double ratio_val = this->population_size /(double)100 * ratio;
 	unsigned int K = (int) ratio_val;
-	vector< GAIndividual* > parents;		// current set of individuals
-
-	// loop (rounds)
-	for (unsigned int i = 0; i < this->population_size; i++) {
-
-		// new_generation_ratio is fixed and set to 2
-		// so we'll create two parents
-		for (unsigned int j = 0; j < this->new_generation_ratio; j++) {
-			vector<GAIndividual*> candidates;	// individuals in this round
-			vector<GAIndividual*> no_good;	// avoid past individuals
-			GAIndividual* winner;
-
-			// K-tournament
-			for (unsigned int j = 0; j < K; j++) {
-				GAIndividual* c = choose_random(this->population, no_good);
-				candidates.push_back(c);
-
-				no_good.push_back(candidates.at(j));
+	K = std::max(1u, std::min(K, (unsigned int) this->population.size()));
+
+	unsigned int parents_per_round = this->new_generation_ratio;
+	vector< Slot > parents(this->population_size * parents_per_round);		// current set of individuals
+
+	// loop (rounds), in parallel
+	run_chunks(this->population_size, [&](unsigned int from, unsigned int to, Workspace& ws) {
+		for (unsigned int i = from; i < to; i++) {
+			// new_generation_ratio is fixed and set to 2
+			// so we'll create two parents
+			for (unsigned int j = 0; j < parents_per_round; j++) {
+				parents[i * parents_per_round + j] = ws.selection.select(this->population, this->fitness, K, ws.rng);
 			}
-
-			// Choose a winner
-			winner = choose_best(candidates);
-			parents.push_back(winner);
 		}
-	}
+	});
 
 	return parents;
 }
@@ -82,193 +178,199 @@ vector< GAIndividual* > GAPopulation::create_mating_pool(unsigned int ratio) {
 *	@brief	Generate a pool of individual from another pool (crossover).
 *
 *	@section DESCRIPTION
-*	Crossover is a 2 cut-point crossover.
+*	Children come from the crossover operator (2 cut-point order
+*	crossover or EAX) and may mutate (inversion).
+*	Children are independent: they are created (and mutated) in parallel,
+*	each one in a slot taken beforehand.
+*	Children that are clones of an individual of the population are
+*	dropped before the local search, the ones that are clones of each
+*	other (or became a clone in the local search) right after.
 *
 *	@return set of individuals (dimension is: original / new_generation_ratio)
 */
-vector< GAIndividual* > GAPopulation::crossover(vector< GAIndividual* > pool) {
-	vector< GAIndividual* > offsprings;
+template <class Operators>
+vector< Slot > GAPopulation<Operators>::crossover(const vector< Slot >& pool) {
+	vector< Slot > offsprings(pool.size() / 2);
+
+	// take all the slots now: the pool must not grow while
+	// the workers are writing into it
+	for (unsigned int i = 0; i < offsprings.size(); i++) {
+		offsprings[i] = acquire_slot();
+	}
+
+	this->rejected.assign(offsprings.size(), 0);
 
 	// consider two individuals at each iteration
-	for (unsigned int i = 0; i < pool.size(); i += 2 ) {
-		// Create a child that can mutate
-		GAIndividual* child = mutate(cut_point_crossover(pool.at(i), pool.at(i+1)));
-		offsprings.push_back(child);
-	}
+	run_chunks(offsprings.size(), [&](unsigned int from, unsigned int to, Workspace& ws) {
+		// whether each child mutates: drawn all at once
+		ws.mutation_draws.resize(to - from);
+		ws.rng.uniform_doubles(&ws.mutation_draws[0], to - from);
+
+		for (unsigned int i = from; i < to; i++) {
+			// Create a child that can mutate
+			Slot p1 = pool[2*i];
+			Slot child = offsprings[i];
+			this->fitness[child] = ws.crossover.cross(this->problem, get_tour(p1), this->fitness[p1], \
+													get_tour(pool[2*i + 1]), get_tour(child), \
+													ws.rng, ws.changed_nodes);
+#ifdef DELTA_CHECK
+			double full_cost = TSPSolution::path_cost(this->problem, get_tour(child), 0, this->tour_length - 1);
+			assert(fabs(full_cost - this->fitness[child]) <= 1e-6 * std::max(1.0, full_cost));
+#endif
+			// the child is a new tour: hashed once, then kept up to date
+			this->hashes[child] = TourHash::of(get_tour(child), this->tour_length - 1, this->problem->is_symmetric());
+			mutate(child, ws.mutation_draws[i - from], ws);
+
+			if (in_population(this->hashes[child])) {
+				this->rejected[i] = 1;
+				continue;
+			}
+			if (this->local_search_budget > 0) {
+				local_search(child, ws);
+			}
+		}
+	});
 
+	drop_clones(offsprings);
 	return offsprings;
 }
 
-
 /**
-*	@brief	Generate an individual from another two using 2-cut point crossover.
+*	@brief	Remove from <offsprings> the children marked as clones,
+*			the ones whose tour is in the population and the ones
+*			whose tour is the same of a previous child.
+*			Their slots are recycled.
 *
-*	@section DESCRIPTION
-*	After K cut points are defined, the child is obtained by copying
-*	the block between the cut points from the first and the second parents
-*	alternatively.
-*	We use K=2, so it's a 2-cyt point crossover.
-*	In order to preserve feasible solutions, the order crossover is implemented.
-*	the child takes the external blocks from one parent and the inner genes
-*	are taken from the second parent in order of their appearance in the second parent.
-*
-*	@return one individual
+*	@return void
 */
-GAIndividual* GAPopulation::cut_point_crossover(GAIndividual* p1, GAIndividual* p2) {
-	unsigned int k1, k2;
-	unsigned int N = this->problem->get_size();
-
-	// Computing the two k points randomly, s.t.
-	// - k1, k2 >= 1, k1, k2 <= problem.N
-	// - k2 - k1 > 2
-	while (1) {
-		k1 = (rand() % (N-1)) + 1;
-		k2 = (rand() % (N-1)) + 1;
-
-		if (( k2 <= k1) || ((k2 - k1) < 2)) { continue; }
-		break;
-	}
-
-	vector<Node> p1_path = p1->get_path();
-	vector<Node> p2_path = p2->get_path();
-
-	// Create the path for the child
-	vector<Node> child_path;
-	child_path.resize(N + 1);
-
-	// The nodes unused from the first parent
-	// will be taken from the second
-	vector<Node> available(N-1);
-	for (unsigned int i = 0; i < N-1; i++) {
-		available[i] = i+1;
-	}
-
-	// copying the first external block (left)
-	for (unsigned int i = 0; i <= k1; i++) {
-		child_path[i] = p1_path[i];
-		if (i == 0) { continue; }	// skip the first (awalys at 0)
-		available.erase(std::remove(available.begin(), available.end(), p1_path[i]), available.end());
-	}
-
-	// copyin the external block (right)
-	for (unsigned int i = k2; i < p1_path.size(); i++) {
-		child_path[i] = p1_path[i];
-		if (i == N) { continue; }	// skip the last (awalys at 0)
-		available.erase(std::remove(available.begin(), available.end(), p1_path[i]), available.end());
+template <class Operators>
+void GAPopulation<Operators>::drop_clones(vector< Slot >& offsprings) {
+	this->offspring_hashes.clear();
+	for (unsigned int i = 0; i < offsprings.size(); i++) {
+		if (this->rejected[i]) { continue; }
+		uint64_t hash = this->hashes[offsprings[i]];
+		if (in_population(hash)) {
+			this->rejected[i] = 1;
+		} else {
+			this->offspring_hashes.push_back(make_pair(hash, i));
+		}
 	}
 
-	// create the inner block by copying the remaing nodes
-	// from the second parent
-	// Starting in the first free p1 position (k1+1)
-	for (unsigned int i = k1+1; i < k2; i++) {
-		// Check each p2 element from 1 to N
-		for (unsigned int j = 1; j < N; j++) {
-			unsigned int el = p2_path[j];
-			if (std::find(available.begin(), available.end(), el) != available.end()) {
-				// This element is in the avaiable list so can be used
-				child_path[i] = el;
-
-				// Delete the element and skip to the next i position in p1
-				available.erase(std::remove(available.begin(), available.end(), el), available.end());
-				break;
-			}
+	// equal hashes end up next to each other (the first child is kept)
+	std::sort(this->offspring_hashes.begin(), this->offspring_hashes.end());
+	for (unsigned int k = 1; k < this->offspring_hashes.size(); k++) {
+		if (this->offspring_hashes[k].first == this->offspring_hashes[k - 1].first) {
+			this->rejected[this->offspring_hashes[k].second] = 1;
 		}
 	}
 
-	// final check: node 0 should be in the first and in the last positions only
-	// if not, something went wrong
-	unsigned int zeros = 2;
-	for (unsigned int i = 0; i < child_path.size(); i++) {
-		if (child_path.at(i) == 0) {
-			zeros--;
+	unsigned int kept = 0;
+	for (unsigned int i = 0; i < offsprings.size(); i++) {
+		if (this->rejected[i]) {
+			release_slot(offsprings[i]);
+		} else {
+			offsprings[kept++] = offsprings[i];
 		}
 	}
-	assert(zeros == 0);
-
-	// Create a new child with the path created upon
-	return new GAIndividual(this->problem, child_path);
+	offsprings.resize(kept);
 }
 
 /**
-*	@brief	Mutate a individual using inversion mutation method.
+*	@brief	Sort the hashes of the population, for in_population()
 *
-*	@section DESCRIPTION
-*	Two point are randomly generated and then the sublist between them is revered.
-*
-*	@return a mutated individual
+*	@return void
 */
-GAIndividual* GAPopulation::mutate(GAIndividual* individual) {
-	// mutate with probability <mutation_probability>
-	double prob = rand() / double(RAND_MAX);
-    if (prob >= mutation_probability) {
-		return individual;
+template <class Operators>
+void GAPopulation<Operators>::index_population() {
+	this->population_hashes.resize(this->population.size());
+	for (unsigned int i = 0; i < this->population.size(); i++) {
+		this->population_hashes[i] = this->hashes[this->population[i]];
 	}
+	std::sort(this->population_hashes.begin(), this->population_hashes.end());
+}
 
-	unsigned int z, t;
-	unsigned int N = this->problem->get_size();
-
-	// Computing the two points randomly, s.t.
-	// - z,t >= 1, z, t <= problem.N
-	// - z < t
-	while (1) {
-		z = (rand() % (N-1)) + 1;
-		t = (rand() % (N-1)) + 1;
 
-		if (z < t) break;
+/**
+*	@brief	Mutate an individual with the mutation operator (inversion),
+*			given the random number <draw> in [0, 1) that decides whether
+*			to mutate, and using the given workspace.
+*			Fitness and hash are updated with the changes of the move.
+*
+*	@return void
+*/
+template <class Operators>
+void GAPopulation<Operators>::mutate(Slot individual, double draw, Workspace& ws) {
+	// mutate with probability <mutation_probability>
+    if (draw >= mutation_probability) {
+		return;
 	}
 
-	vector<Node> p = individual->get_path();
-	vector<Node> new_path(N+1);	// new path for the individual
-	new_path[0] = 0;	// as always the first and the last
-	new_path[N] = 0;	// node are set to 0
-
-	// the first and the last part are the same
-	for (unsigned int i = 1; i < z; i++ )
-		new_path[i] = p[i];
+	this->fitness[individual] += ws.mutation.mutate(this->problem, get_tour(individual), \
+													this->hashes[individual], ws.rng, ws.changed_nodes);
 
-	for (unsigned int i = t+1; i < N+1; i++ )
-		new_path[i] = p[i];
-
-	// do the magic
-	unsigned int j = 0;
-	for (unsigned int i = z; i <= t; i++ ) {
-		new_path[i] = p[t-j];
-		j++;
-	}
-
-	return new GAIndividual(this->problem, new_path);
+#ifdef DELTA_CHECK
+	double full_cost = TSPSolution::path_cost(this->problem, get_tour(individual), 0, this->tour_length - 1);
+	assert(fabs(full_cost - this->fitness[individual]) <= 1e-6 * std::max(1.0, full_cost));
+	assert(this->hashes[individual] == TourHash::of(get_tour(individual), this->tour_length - 1, \
+													this->problem->is_symmetric()));
+#endif
 }
 
 /**
-*	@brief	Merge the old population with the offspring and produce a new generation.
-*
-*	@section DESCRIPTION
-*	Method used: selection of the bests.
-*	N individuals are selected from a pool of N+R individuals where
-*	R is the dimension of the offspring.
+*	@brief	Enable the memetic mode: every child is improved with
+*			2-opt moves (among its <neighbors> nearest neighbors)
+*			examining at most <budget> nodes. 0 disables it.
+*			Asymmetric problems are left as they are.
 *
 *	@return void
 */
-void GAPopulation::population_management(vector< GAIndividual* > pool) {
-	vector< GAIndividual* > new_population;
-
-	// Create a new (provisional) population with the old one and the offspring
-	// with dimension N + R (actually: population_size * new_generation_ratio)
-	this->population.insert( this->population.end(), pool.begin(), pool.end() );
-
-	for (unsigned int i = 0; i < this->population_size; i++) {
-		GAIndividual* selected = montecarlo_selection(this->population);
-
-		// Remove the individual from the current population
-		this->population.erase(std::remove(this->population.begin(), \
-									this->population.end(), selected), this->population.end());
+template <class Operators>
+void GAPopulation<Operators>::enable_local_search(unsigned int budget, unsigned int neighbors) {
+	if (!this->problem->is_symmetric()) { budget = 0; }
+	if (budget > 0) { this->problem->build_neighbors(neighbors); }
+	this->local_search_budget = budget;
+}
 
+/**
+*	@brief	Improve an individual with 2-opt moves, starting from
+*			the nodes changed by crossover and mutation (the rest
+*			of the tour comes from a parent).
+*			The fitness is updated with the gain of the moves.
+*
+*	@return void
+*/
+template <class Operators>
+void GAPopulation<Operators>::local_search(Slot individual, Workspace& ws) {
+	ws.local_search.load(this->problem, get_tour(individual));
+	for (auto & n : ws.changed_nodes) { ws.local_search.activate(n); }
+	this->fitness[individual] += ws.local_search.optimize(this->local_search_budget);
+	this->hashes[individual] ^= ws.local_search.get_hash_delta();
+
+#ifdef DELTA_CHECK
+	double full_cost = TSPSolution::path_cost(this->problem, get_tour(individual), 0, this->tour_length - 1);
+	assert(fabs(full_cost - this->fitness[individual]) <= 1e-6 * std::max(1.0, full_cost));
+	assert(this->hashes[individual] == TourHash::of(get_tour(individual), this->tour_length - 1, \
+													this->problem->is_symmetric()));
+#endif
+}
 
-		// Add the individual to the new population
-		new_population.push_back(selected);
+/**
+*	@brief	Merge the old population with the offspring and produce
+*			a new generation with the replacement operator.
+*			The slots of the individuals left out are recycled.
+*
+*	@return void
+*/
+template <class Operators>
+void GAPopulation<Operators>::population_management(const vector< Slot >& pool) {
+	this->replacement.replace(this->population, pool, this->fitness, this->population_size, \
+							this->rng, this->discarded);
+
+	// Whoever was not selected is discarded
+	for (auto & s : this->discarded) {
+		release_slot(s);
 	}
-
-	this->population = new_population;
+	index_population();
 }
 
 /**
@@ -282,9 +384,11 @@ void GAPopulation::population_management(vector< GAIndividual* > pool) {
 *
 *	@return an individual
 */
-GAIndividual* GAPopulation::montecarlo_selection(vector< GAIndividual* > pool) {
+template <class Operators>
+Slot GAPopulation<Operators>::montecarlo_selection(vector< Slot > pool) {
 	// Sort the population by their fitness value
-	std::sort(pool.begin(), pool.end(), GAPopulation::sort_by_fitness);
+	const vector<double>& f = this->fitness;
+	std::sort(pool.begin(), pool.end(), [&f](Slot a, Slot b) { return f[a] < f[b]; });
 
 	vector< double > probabilities;	// probability of a node to be selected
 	// Compute sum of f_k
@@ -293,7 +397,7 @@ GAIndividual* GAPopulation::montecarlo_selection(vector< GAIndividual* > pool) {
 		long double f_k_sum;	// sum of f_k
 
 		for (auto & element : pool) {
-			f_i.push_back(element->get_fitness());
+			f_i.push_back(f[element]);
 		}
 		f_k_sum = std::accumulate(f_i.begin(), f_i.end(), 0.0);
 
@@ -303,8 +407,8 @@ GAIndividual* GAPopulation::montecarlo_selection(vector< GAIndividual* > pool) {
 		}
 	}
 
-	// Choose a random number k s.t. 0<k<1
-	double k = (double) rand() / (RAND_MAX);
+	// Choose a random number k s.t. 0<=k<1
+	double k = this->rng.uniform_double();
 
 	double tot = 0;	// p_i so far
 	unsigned int i = 0;
@@ -325,78 +429,170 @@ GAIndividual* GAPopulation::montecarlo_selection(vector< GAIndividual* > pool) {
 
 
 /**
-*	@brief	Return the best individual from the given set of individuals
+*	@brief	Retrieve the slot of the best individual in the population
 *
-*	@return an individual
+*	@return a slot
 */
-GAIndividual* GAPopulation::choose_best(vector<GAIndividual*> pool) {
-	double bestValue = INT_MAX;
-	unsigned long index = pool.size()+1;
-	for (unsigned long i = 0; i < pool.size(); ++i) {
-		if (pool.at(i)->get_fitness() < bestValue){
-			bestValue = pool.at(i)->get_fitness();
-			index = i;
-		}
-	}
-	return pool.at(index);
+template <class Operators>
+Slot GAPopulation<Operators>::get_best_slot() {
+	const vector<double>& f = this->fitness;
+	return *min_element(this->population.begin(), this->population.end(), \
+						[&f](Slot a, Slot b) { return f[a] < f[b]; });
 }
 
 /**
-*	@brief	Return a random individual from the given set of individuals
+*	@brief	Retrieve the slot of the worst individual in the population
 *
-*	@return an individual
+*	@return a slot
 */
-GAIndividual* GAPopulation::choose_random(vector<GAIndividual*> pool, vector<GAIndividual*>  not_good) {
-	GAIndividual* candidate;
-	unsigned int val;
-
-	while (1) {
-		// Choose one randomly
-		val = rand() % (unsigned int) pool.size();
-		candidate = pool.at(val);
-
-		// Check if it's a good candidate, that is,
-		// it's not int the not_good pool
-		bool good_candidate = true;
-		unsigned int i = 0;
-		while ((i < not_good.size()) && good_candidate) {
-			if (not_good.at(i) == candidate) {
-				good_candidate = false;
-			}
+template <class Operators>
+Slot GAPopulation<Operators>::get_worst_slot() {
+	const vector<double>& f = this->fitness;
+	return *max_element(this->population.begin(), this->population.end(), \
+						[&f](Slot a, Slot b) { return f[a] < f[b]; });
+}
 
-			i++;
-		}
+/**
+*	@brief	Fitness of the best individual in the population
+*
+*	@return fitness value
+*/
+template <class Operators>
+double GAPopulation<Operators>::get_best_fitness() {
+	return this->fitness[get_best_slot()];
+}
 
-		if (good_candidate) { break; }
+/**
+*	@brief	Fitness of the worst individual in the population
+*
+*	@return fitness value
+*/
+template <class Operators>
+double GAPopulation<Operators>::get_worst_fitness() {
+	return this->fitness[get_worst_slot()];
+}
+
+/**
+*	@brief	Mean fitness of the population
+*
+*	@return fitness value
+*/
+template <class Operators>
+double GAPopulation<Operators>::get_mean_fitness() const {
+	double sum = 0;
+	for (auto & s : this->population) { sum += this->fitness[s]; }
+	return sum / this->population.size();
+}
+
+/**
+*	@brief	Diversity of the population: the fraction of edges of one
+*			tour that are not in another, averaged over <pairs> pairs.
+*
+*	@section DESCRIPTION
+*	Pair k is made of the individuals in positions k*P/pairs and
+*	k*P/pairs + P/2 of the population: no random numbers are drawn,
+*	so the run does not change when the diversity is looked at.
+*	Each pair costs O(N).
+*
+*	@return diversity, from 0 (all the same) to 1
+*/
+template <class Operators>
+double GAPopulation<Operators>::get_diversity(unsigned int pairs) {
+	unsigned int P = this->population.size();
+	unsigned int N = this->tour_length - 1;
+	pairs = std::min(pairs, P / 2);
+	if (pairs == 0) { return 0; }
+
+	this->diversity_next.resize(N);
+	this->diversity_prev.resize(N);
+	double sum = 0;
+	for (unsigned int k = 0; k < pairs; k++) {
+		const Node* a = get_tour(this->population[k * P / pairs]);
+		const Node* b = get_tour(this->population[(k * P / pairs + P / 2) % P]);
+
+		for (unsigned int i = 0; i < N; i++) {
+			this->diversity_next[a[i]] = a[i + 1];
+			this->diversity_prev[a[i + 1]] = a[i];
+		}
+		unsigned int different = 0;
+		for (unsigned int i = 0; i < N; i++) {
+			if ((this->diversity_next[b[i]] != b[i + 1]) && (this->diversity_prev[b[i]] != b[i + 1])) {
+				different++;
+			}
+		}
+		sum += different / (double) N;
 	}
+	return sum / pairs;
+}
 
-	return candidate;
+/**
+*	@brief	Retrieve (a copy of) the best individual in the population
+*
+*	@return a new individual, owned by the caller
+*/
+template <class Operators>
+GAIndividual* GAPopulation<Operators>::get_best_individual() {
+	Slot s = get_best_slot();
+	const Node* tour = get_tour(s);
+	return new GAIndividual(this->problem, vector<Node>(tour, tour + this->tour_length), this->fitness[s]);
 }
 
 /**
-*	@brief	Return true if an individual p1 fitness value is grater than
-*			the fiteness value of individual p2
+*	@brief	Retrieve (a copy of) the worst individual in the population
 *
-*	@return true or false
+*	@return a new individual, owned by the caller
 */
-bool GAPopulation::sort_by_fitness(GAIndividual* p1, GAIndividual* p2) {
-    return p1->get_fitness() < p2->get_fitness();
+template <class Operators>
+GAIndividual* GAPopulation<Operators>::get_worst_individual() {
+	Slot s = get_worst_slot();
+	const Node* tour = get_tour(s);
+	return new GAIndividual(this->problem, vector<Node>(tour, tour + this->tour_length), this->fitness[s]);
 }
 
 /**
-*	@brief	Retrieve the best individual in the population
+*	@brief	Retrieve the <k> best individuals in the population
 *
-*	@return true or false
+*	@return slots, best first
 */
-GAIndividual* GAPopulation::get_best_individual() {
-	return *min_element(this->population.begin(), this->population.end(), GAPopulation::sort_by_fitness);
+template <class Operators>
+vector< Slot > GAPopulation<Operators>::get_elite(unsigned int k) {
+	vector< Slot > elite(this->population);
+	k = std::min(k, (unsigned int) elite.size());
+
+	const vector<double>& f = this->fitness;
+	std::partial_sort(elite.begin(), elite.begin() + k, elite.end(), \
+					[&f](Slot a, Slot b) { return f[a] < f[b]; });
+	elite.resize(k);
+	return elite;
 }
 
 /**
-*	@brief	Retrieve the worst individual in the population
+*	@brief	Put an individual coming from outside (a migrant)
+*			in the place of the worst one, if it's better
+*			and not a clone of an individual of the population.
 *
-*	@return true or false
+*	@return true if the migrant was accepted
 */
-GAIndividual* GAPopulation::get_worst_individual() {
-	return *max_element(this->population.begin(), this->population.end(), GAPopulation::sort_by_fitness);
+template <class Operators>
+bool GAPopulation<Operators>::replace_worst(const Node* tour, double tour_fitness) {
+	Slot worst = get_worst_slot();
+	if (tour_fitness >= this->fitness[worst]) {
+		return false;
+	}
+	uint64_t hash = TourHash::of(tour, this->tour_length - 1, this->problem->is_symmetric());
+	if (in_population(hash)) {
+		return false;
+	}
+
+	std::copy(tour, tour + this->tour_length, get_tour(worst));
+	this->fitness[worst] = tour_fitness;
+	this->hashes[worst] = hash;
+	index_population();
+	return true;
 }
+
+// Configurations compiled in (see GAOperators.h)
+template class GAPopulation<OrderRouletteGA>;
+template class GAPopulation<OrderTruncationGA>;
+template class GAPopulation<EAXRouletteGA>;
+template class GAPopulation<EAXTruncationGA>;
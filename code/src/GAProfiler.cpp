@@ -0,0 +1,217 @@
+/**
+ *  @file    GAProfiler.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief GA profiler class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  Wall time, calls and allocations of the phases of a GA run
+ *	(see GAProfiler.h).
+ *
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <new>
+#include "../include/GAProfiler.h"
+
+using namespace std;
+
+const char* GAProfiler::OUTPUT_FILE = "ga_profile.jsonl";
+
+static std::mutex output_lock;	// runs of a batch append to the same file
+
+#ifdef GA_PROFILE
+// Every allocation of the program is counted (all threads, and per thread)
+static std::atomic<unsigned long> total_allocations(0);
+static std::atomic<unsigned long> total_bytes(0);
+static thread_local unsigned long local_allocations = 0;
+
+void* operator new(size_t size) {
+	total_allocations.fetch_add(1, std::memory_order_relaxed);
+	total_bytes.fetch_add(size, std::memory_order_relaxed);
+	local_allocations++;
+	void* p = malloc(size ? size : 1);
+	if (p == NULL) { throw std::bad_alloc(); }
+	return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+unsigned long GAProfiler::allocations() { return total_allocations.load(std::memory_order_relaxed); }
+unsigned long GAProfiler::allocated_bytes() { return total_bytes.load(std::memory_order_relaxed); }
+unsigned long GAProfiler::thread_allocations() { return local_allocations; }
+#else
+unsigned long GAProfiler::allocations() { return 0; }
+unsigned long GAProfiler::allocated_bytes() { return 0; }
+unsigned long GAProfiler::thread_allocations() { return 0; }
+#endif
+
+/**
+*	@brief	Start timing a block
+*/
+GAProfiler::Scope::Scope(GAProfiler* profiler, GAPhase phase) {
+	this->profiler = profiler;
+	this->phase = phase;
+	this->allocations = GAProfiler::allocations();
+	this->start = Clock::now();
+}
+
+/**
+*	@brief	Add the time of the block to its phase
+*/
+GAProfiler::Scope::~Scope() {
+	unsigned long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - this->start).count();
+	if (this->profiler != NULL) {
+		this->profiler->add(this->phase, ns, GAProfiler::allocations() - this->allocations);
+	}
+}
+
+/**
+*	@brief	Constructor: nothing recorded yet
+*/
+GAProfiler::GAProfiler(unsigned int problem_size, unsigned int threads) {
+	this->problem_size = problem_size;
+	this->threads = threads;
+	for (unsigned int p = 0; p < GA_PHASE_COUNT; p++) {
+		this->phases[p].calls = 0;
+		this->phases[p].ns = 0;
+		this->phases[p].allocations = 0;
+	}
+	Stats empty = { 0, 0, 0 };
+	this->workers.assign(threads, empty);
+}
+
+/**
+*	@brief	Name of phase <phase> in the table and in the JSON
+*
+*	@return the name
+*/
+const char* GAProfiler::phase_name(unsigned int phase) {
+	static const char* names[GA_PHASE_COUNT] = {
+		"init", "mating_pool", "crossover", "population_management", "best_worst_scan", "polish"
+	};
+	return names[phase];
+}
+
+/**
+*	@brief	Start a new generation: the next phases are counted in it
+*
+*	@return void
+*/
+void GAProfiler::start_generation() {
+	this->generations.push_back(vector<unsigned long long>(GA_PHASE_COUNT, 0));
+}
+
+/**
+*	@brief	Add a call of <phase>, which took <ns> and made <allocations>
+*
+*	@return void
+*/
+void GAProfiler::add(GAPhase phase, unsigned long long ns, unsigned long allocations) {
+	this->phases[phase].calls++;
+	this->phases[phase].ns += ns;
+	this->phases[phase].allocations += allocations;
+	if (!this->generations.empty()) {
+		this->generations.back()[phase] += ns;
+	}
+}
+
+/**
+*	@brief	Add a chunk of work done by thread <worker> (each worker
+*			only touches its own entry: no lock needed)
+*
+*	@return void
+*/
+void GAProfiler::add_worker(unsigned int worker, unsigned long long ns, unsigned long allocations) {
+	if (worker >= this->workers.size()) { return; }
+	this->workers[worker].calls++;
+	this->workers[worker].ns += ns;
+	this->workers[worker].allocations += allocations;
+}
+
+/**
+*	@brief	Print the totals of the phases and of the workers
+*
+*	@return void
+*/
+void GAProfiler::print(ostream& out) const {
+	unsigned long long total = 0;
+	for (unsigned int p = 0; p < GA_PHASE_COUNT; p++) { total += this->phases[p].ns; }
+
+	out << " Profile (" << this->generations.size() << " generations):" << endl;
+	out << "  " << std::left << std::setw(24) << "phase" << std::right \
+		<< std::setw(10) << "calls" << std::setw(14) << "total [ms]" << std::setw(8) << "%" \
+		<< std::setw(14) << "avg [us]" << std::setw(14) << "allocs" << endl;
+	for (unsigned int p = 0; p < GA_PHASE_COUNT; p++) {
+		const Stats& s = this->phases[p];
+		if (s.calls == 0) { continue; }
+		out << "  " << std::left << std::setw(24) << phase_name(p) << std::right << std::fixed \
+			<< std::setw(10) << s.calls \
+			<< std::setw(14) << std::setprecision(1) << s.ns / 1e6 \
+			<< std::setw(8) << std::setprecision(1) << ((total > 0) ? 100.0 * s.ns / total : 0) \
+			<< std::setw(14) << std::setprecision(1) << s.ns / 1e3 / s.calls \
+			<< std::setw(14) << s.allocations << endl;
+	}
+	for (unsigned int w = 0; w < this->workers.size(); w++) {
+		const Stats& s = this->workers[w];
+		out << "  " << std::left << std::setw(24) << ("thread " + std::to_string(w)) << std::right \
+			<< std::setw(10) << s.calls \
+			<< std::setw(14) << std::setprecision(1) << s.ns / 1e6 \
+			<< std::setw(8) << "" << std::setw(14) << "" \
+			<< std::setw(14) << s.allocations << endl;
+	}
+	out.unsetf(std::ios::fixed);
+}
+
+/**
+*	@brief	Write everything as one line of JSON
+*
+*	@return void
+*/
+void GAProfiler::write_json(ostream& out) const {
+	out << "{\"problem_size\": " << this->problem_size \
+		<< ", \"threads\": " << this->threads \
+		<< ", \"generations\": " << this->generations.size() \
+		<< ", \"phases\": {";
+	for (unsigned int p = 0; p < GA_PHASE_COUNT; p++) {
+		const Stats& s = this->phases[p];
+		out << ((p > 0) ? ", " : "") << "\"" << phase_name(p) << "\": {\"calls\": " << s.calls \
+			<< ", \"ns\": " << s.ns << ", \"allocations\": " << s.allocations << "}";
+	}
+	out << "}, \"threads_chunks\": [";
+	for (unsigned int w = 0; w < this->workers.size(); w++) {
+		const Stats& s = this->workers[w];
+		out << ((w > 0) ? ", " : "") << "{\"chunks\": " << s.calls \
+			<< ", \"ns\": " << s.ns << ", \"allocations\": " << s.allocations << "}";
+	}
+	out << "], \"per_generation_ns\": {";
+	for (unsigned int p = 0; p < GA_PHASE_COUNT; p++) {
+		out << ((p > 0) ? ", " : "") << "\"" << phase_name(p) << "\": [";
+		for (unsigned int g = 0; g < this->generations.size(); g++) {
+			out << ((g > 0) ? ", " : "") << this->generations[g][p];
+		}
+		out << "]";
+	}
+	out << "}}" << endl;
+}
+
+/**
+*	@brief	Append the JSON line to <filename>
+*
+*	@return void
+*/
+void GAProfiler::append_json(const string& filename) const {
+	std::lock_guard<std::mutex> guard(output_lock);
+	ofstream out(filename, ios::out | ios::app);
+	write_json(out);
+}
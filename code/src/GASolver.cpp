@@ -15,6 +15,7 @@
 
 #include "../include/GASolver.h"
 #include "../include/GAPopulation.h"
+#include "../include/GAProfiler.h"
 #include <iostream>
 #include <sys/time.h>
 #include <math.h>
@@ -24,39 +25,123 @@ using namespace std;
 /**
 *	@brief	Default constructor
 */
-GASolver::GASolver(TSPProblem *problem, unsigned int pop_size_factor, \
+template <class Operators>
+GASolver<Operators>::GASolver(TSPProblem *problem, unsigned int pop_size_factor, \
 		unsigned int t_limit, unsigned int itr_limit,
 		double mutation_pr,
-		bool vvv) {
+		bool vvv,
+		unsigned int n_threads,
+		uint64_t seed) {
     this->problem = problem;
     this->population_size = problem->get_size() * pop_size_factor;
     this->time_limit = (long long) t_limit * 1000;	// seconds to milliseconds
 	this->iterations_limit = itr_limit;
     this->mutation_probability = mutation_pr;
 	this->verbose = vvv;
+	this->local_search_budget = 0;
+	this->polish = false;
+	this->threads = (n_threads > 0) ? n_threads : 1;
+	this->seed = seed;
+}
+
+/**
+*	@brief	Improve every child with 2-opt moves, examining at most
+*			<budget> nodes each (see GAPopulation::enable_local_search())
+*
+*	@return void
+*/
+template <class Operators>
+void GASolver<Operators>::set_local_search(unsigned int budget) {
+	this->local_search_budget = budget;
+}
+
+/**
+*	@brief	Improve the best tour found with 2-opt and Or-opt
+*			before returning it (see TSPSolution::improve())
+*
+*	@return void
+*/
+template <class Operators>
+void GASolver<Operators>::set_polish(bool polish) {
+	this->polish = polish;
+}
+
+/**
+*	@brief	Write a record per generation to <filename>
+*			(see TraceWriter; empty: no trace)
+*
+*	@return void
+*/
+template <class Operators>
+void GASolver<Operators>::set_trace(const string& filename) {
+	this->trace_file = filename;
+}
+
+/**
+*	@brief	Add the state of <population> to the trace
+*
+*	@return void
+*/
+template <class Operators>
+void GASolver<Operators>::trace_generation(TraceWriter* trace, GAPopulation<Operators>* population, \
+										unsigned int generation, long long elapsed, double best, double worst) {
+	TraceWriter::Record record;
+	record.generation = generation;
+	record.elapsed = elapsed;
+	record.best = best;
+	record.worst = worst;
+	record.mean = population->get_mean_fitness();
+	record.diversity = population->get_diversity();
+	trace->write(record);
 }
 
 /**
 *	@brief	Main function: solve the problem using a gen. algo.
+*
+*	@section DESCRIPTION
+*	With GA_PROFILE the phases are timed (see GAProfiler): the
+*	table is printed at the end (verbose mode) and the JSON line
+*	appended to GAProfiler::OUTPUT_FILE.
 */
-GAIndividual* GASolver::solve() {
+template <class Operators>
+GAIndividual* GASolver<Operators>::solve() {
+	// Workers for the offspring production (none if single threaded)
+	ThreadPool* workers = (this->threads > 1) ? new ThreadPool(this->threads) : NULL;
+
+#ifdef GA_PROFILE
+	GAProfiler profiler(this->problem->get_size(), this->threads);
+	GAProfiler* profile = &profiler;
+#endif
+
 	// Phase 1: create the first population
-	GAPopulation* population = new GAPopulation(this->population_size,\
+	GAPopulation<Operators>* population;
+	{
+		GA_PROFILE_SCOPE(profile, GA_PHASE_INIT);
+		population = new GAPopulation<Operators>(this->population_size,\
 											this->mutation_probability, \
-											this->problem);
+											this->problem, \
+											this->seed, \
+											workers);
+		population->enable_local_search(this->local_search_budget);
+	}
+#ifdef GA_PROFILE
+	population->set_profiler(profile);
+#endif
 
-	// individuals used for statistics over the iterations
-	// and for return the best individual at the end
-	GAIndividual* best;
-	GAIndividual* worst;
+	// fitness values used for statistics over the iterations
+	double best;
+	double worst;
 
-	best = population->get_best_individual();
-	worst = population->get_worst_individual();
+	{
+		GA_PROFILE_SCOPE(profile, GA_PHASE_SCAN);
+		best = population->get_best_fitness();
+		worst = population->get_worst_fitness();
+	}
 
 	if (this->verbose) {
 		cout << " Start" \
-			<< ": Worst " << worst->get_fitness() \
-			<< ", Best: " << best->get_fitness() << endl;
+			<< ": Worst " << worst \
+			<< ", Best: " << best << endl;
 	}
 
 	// Counting how much consegutive iterations
@@ -70,59 +155,106 @@ GAIndividual* GASolver::solve() {
 	unsigned int i = 0;	// current itereation
 	long long t_start = current_timestamp();	// time in milliseconds
 
+	// Convergence trace: generation 0 is the first population
+	TraceWriter* trace = NULL;
+	if (!this->trace_file.empty()) {
+		try {
+			trace = new TraceWriter(this->trace_file, this->problem->get_size(), this->population_size);
+			trace_generation(trace, population, 0, 0, best, worst);
+		} catch(std::exception& e) {
+			trace = NULL;	// only a diagnostic: run without it
+			std::cout << "[!] EXCEPTION: " << e.what() << std::endl;
+		}
+	}
+
 	while  ((i < this->iterations_limit) && ((current_timestamp() - t_start) < this->time_limit)) {
+		GA_PROFILE_GENERATION(profile);
+
 		// Phase 2: select the mating pool
-		vector< GAIndividual* > mating_pool;
-		mating_pool = population->create_mating_pool(20);
+		vector< Slot > mating_pool;
+		{
+			GA_PROFILE_SCOPE(profile, GA_PHASE_MATING_POOL);
+			mating_pool = population->create_mating_pool(20);
+		}
 
 		// Phase 3-4: crossover to generate offsprings
 		// and mutate new children according to probability
-		vector< GAIndividual* > offsprings;
-		offsprings = population->crossover(mating_pool);
+		vector< Slot > offsprings;
+		{
+			GA_PROFILE_SCOPE(profile, GA_PHASE_CROSSOVER);
+			offsprings = population->crossover(mating_pool);
+		}
 
 		// Phase 5: population management
-		population->population_management(offsprings);
+		{
+			GA_PROFILE_SCOPE(profile, GA_PHASE_MANAGEMENT);
+			population->population_management(offsprings);
+		}
 
 		// See how thing goes
-		best = population->get_best_individual();
-		worst = population->get_worst_individual();
+		{
+			GA_PROFILE_SCOPE(profile, GA_PHASE_SCAN);
+			best = population->get_best_fitness();
+			worst = population->get_worst_fitness();
+		}
+
+		if (trace != NULL) {
+			trace_generation(trace, population, i + 1, current_timestamp() - t_start, best, worst);
+		}
 
 		// Check for fix point
-		if ( worst->get_fitness() == best->get_fitness() ) { fix_point++; }
+		if ( worst == best ) { fix_point++; }
 
 		// If population diverge, reset fix point counter
-		if (( fix_point > 0) && (worst->get_fitness() != best->get_fitness())) {
+		if (( fix_point > 0) && (worst != best)) {
 			fix_point = 0;
 		}
 
 		// If fix point counter reaches a fixed value stop evolution
 		if ( fix_point > fix_point_limit) { break; }
 
-		best = population->get_best_individual();
-		worst = population->get_worst_individual();
-
 		if (this->verbose && (i > 0) && (i % 100) == 0 ) {
-			best = population->get_best_individual();
-			worst = population->get_worst_individual();
-
 			cout << " Iteration " << i \
-				<< ": Worst " << worst->get_fitness() \
-				<< ", Best: " << best->get_fitness() << endl;
+				<< ": Worst " << worst \
+				<< ", Best: " << best << endl;
 		}
 
 		i++;
 	}
 
-	best = population->get_best_individual();
-	worst = population->get_worst_individual();
-
 	if (this->verbose) {
 		cout << " End (itertion: " << i \
-			<< "): Worst " << worst->get_fitness() \
-			<< ", Best: " << best->get_fitness() << endl;
+			<< "): Worst " << worst \
+			<< ", Best: " << best << endl;
+	}
+
+	// The population (and its pool) is no longer needed:
+	// return a copy of the best individual
+	GAIndividual* best_individual;
+	{
+		GA_PROFILE_SCOPE(profile, GA_PHASE_SCAN);
+		best_individual = population->get_best_individual();
 	}
+	delete population;
+	delete workers;
+	delete trace;	// writes what is left
 
-	return best;
+	if (this->polish) {
+		GA_PROFILE_SCOPE(profile, GA_PHASE_POLISH);
+		best_individual->improve();
+		if (this->verbose) {
+			cout << " Polished: " << best_individual->get_solution_cost() << endl;
+		}
+	}
+
+#ifdef GA_PROFILE
+	if (this->verbose) {
+		profiler.print(cout);
+	}
+	profiler.append_json(GAProfiler::OUTPUT_FILE);
+#endif
+
+	return best_individual;
 }
 
 /**
@@ -130,9 +262,16 @@ GAIndividual* GASolver::solve() {
 *
 *	@return return time [milliseconds]
 */
-long long GASolver::current_timestamp() {
+template <class Operators>
+long long GASolver<Operators>::current_timestamp() {
     struct timeval te;
     gettimeofday(&te, NULL);	// get current time
     long long milliseconds = te.tv_sec*1000LL + te.tv_usec/1000;	// caculate milliseconds
     return milliseconds;
 }
+
+// Configurations compiled in (see GAOperators.h)
+template class GASolver<OrderRouletteGA>;
+template class GASolver<OrderTruncationGA>;
+template class GASolver<EAXRouletteGA>;
+template class GASolver<EAXTruncationGA>;
@@ -0,0 +1,151 @@
+/**
+ *  @file    LKSearch.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Lin-Kernighan local search class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  A Lin-Kernighan style local search working in place on a tour
+ *	buffer (see LocalSearch).
+ *
+ */
+
+#include <algorithm>
+#include "../include/LKSearch.h"
+
+using namespace std;
+
+const unsigned int LKSearch::BREADTH[LKSearch::MAX_DEPTH] = {5, 3, 1, 1};
+
+/**
+*	@brief	Look for an improving sequential move starting by
+*			removing one of the two edges of node <a> (= t1).
+*
+*	@return true if the tour changed (<delta> is updated)
+*/
+bool LKSearch::improve_node(Node a, double& delta) {
+	Node sides[2] = { succ(a), pred(a) };
+	for (int side = 0; side < 2; side++) {
+		this->touched.clear();
+		this->touched.push_back(a);
+		this->touched.push_back(sides[side]);
+
+		if (extend(a, sides[side], 0, 0, delta)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+*	@brief	One level of the chain: the tour has the edge (t1,t2),
+*			and is <chain_delta> longer than at the start.
+*
+*	@section DESCRIPTION
+*	Edge (t1,t2) is removed, (t2,t3) added with t3 a neighbor of t2,
+*	(t3,t4) removed and (t4,t1) added, t4 being the only neighbor of
+*	t3 that gives a tour back (a 2-opt move). Then (t4,t1) is the edge
+*	to remove at the next level.
+*	The gain of the chain without its closing edge must stay positive:
+*	this bounds C_t2,t3 and stops the scan of the (sorted) neighbors.
+*	Candidates are tried in order of C_t3,t4 - C_t2,t3.
+*	Moves that do not lead to an improvement are undone.
+*
+*	@return true if the tour improved (<delta> is updated)
+*/
+bool LKSearch::extend(Node t1, Node t2, unsigned int level, double chain_delta, double& delta) {
+	bool forward = (t2 == succ(t1));
+	double gain = this->problem->cost(t1, t2) - chain_delta;	// without the closing edge
+
+	// best candidates, by score
+	unsigned int breadth = BREADTH[level];
+	Node cand_t3[5], cand_t4[5];
+	double cand_score[5];
+	unsigned int count = 0;
+
+	const NeighborLists& neighbors = this->problem->get_neighbors();
+	for (const Node* it = neighbors.begin(t2); it != neighbors.end(t2); ++it) {
+		Node t3 = *it;
+		double c23 = this->problem->cost(t2, t3);
+		if (gain - c23 <= EPSILON) { break; }
+
+		Node t4 = forward ? pred(t3) : succ(t3);
+		if ((t3 == t1) || (t4 == t2)) { continue; }
+
+		double score = this->problem->cost(t3, t4) - c23;
+		unsigned int i = std::min(count, breadth - 1);
+		if ((count == breadth) && (score <= cand_score[i])) { continue; }
+		for (; (i > 0) && (cand_score[i - 1] < score); i--) {
+			cand_t3[i] = cand_t3[i - 1];
+			cand_t4[i] = cand_t4[i - 1];
+			cand_score[i] = cand_score[i - 1];
+		}
+		cand_t3[i] = t3;
+		cand_t4[i] = t4;
+		cand_score[i] = score;
+		count = std::min(count + 1, breadth);
+	}
+
+	for (unsigned int c = 0; c < count; c++) {
+		Node t3 = cand_t3[c];
+		Node t4 = cand_t4[c];
+		double move_delta = chain_delta \
+						+ this->problem->cost(t2, t3) + this->problem->cost(t4, t1) \
+						- this->problem->cost(t1, t2) - this->problem->cost(t3, t4);
+
+		unsigned int p, q;
+		flip(t1, t2, t3, t4, p, q);
+		this->touched.push_back(t3);
+		this->touched.push_back(t4);
+
+		if (move_delta < -EPSILON) {
+			delta += move_delta;
+			for (auto & n : this->touched) { activate(n); }
+			return true;
+		}
+		if ((level + 1 < MAX_DEPTH) && extend(t1, t4, level + 1, move_delta, delta)) {
+			return true;
+		}
+
+		// no luck: back to the previous tour
+		reverse(p, q);
+		this->touched.pop_back();
+		this->touched.pop_back();
+	}
+	return false;
+}
+
+/**
+*	@brief	Apply the 2-opt move replacing (t1,t2) and (t3,t4)
+*			with (t2,t3) and (t4,t1). <p> and <q> are set to the
+*			range to pass to reverse() to undo it.
+*
+*	@return void
+*/
+void LKSearch::flip(Node t1, Node t2, Node t3, Node t4, unsigned int& p, unsigned int& q) {
+	bool forward = (t2 == succ(t1));
+	unsigned int e1 = forward ? edge_after(t1) : edge_before(t1);	// (t1,t2)
+	unsigned int e2 = forward ? edge_before(t3) : edge_after(t3);	// (t4,t3)
+
+	p = std::min(e1, e2);
+	q = std::max(e1, e2);
+	reverse(p, q);
+}
+
+/**
+*	@brief	Reverse the path in positions [p+1, q] (node 0 never moves)
+*
+*	@return void
+*/
+void LKSearch::reverse(unsigned int p, unsigned int q) {
+	toggle_edge(this->path[p], this->path[p + 1]);
+	toggle_edge(this->path[q], this->path[q + 1]);
+	toggle_edge(this->path[p], this->path[q]);
+	toggle_edge(this->path[p + 1], this->path[q + 1]);
+
+	std::reverse(this->path + p + 1, this->path + q + 1);
+	update_positions(p + 1, q);
+}
@@ -0,0 +1,163 @@
+/**
+ *  @file    LKSolver.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief LK Solver class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  This class represents a solver for the TSP problem
+ *	using an iterated Lin-Kernighan local search.
+ *
+ */
+
+#include "../include/LKSolver.h"
+#include <algorithm>
+#include <iostream>
+#include <sys/time.h>
+
+using namespace std;
+
+/**
+*	@brief	Default constructor
+*/
+LKSolver::LKSolver(TSPProblem* problem, unsigned int t_limit, unsigned int itr_limit, \
+		bool vvv,
+		uint64_t seed) {
+	this->problem = problem;
+	this->time_limit = (long long) t_limit * 1000;	// seconds to milliseconds
+	this->iterations_limit = itr_limit;
+	this->verbose = vvv;
+	this->seed = seed;
+}
+
+/**
+*	@brief	Main function: solve the problem using iterated LK.
+*			Stops after <itr_limit> kicks or when time exceeds.
+*/
+TSPSolution* LKSolver::solve() {
+	long long t_start = current_timestamp();	// time in milliseconds
+	RandomEngine rng(this->seed);
+	this->problem->build_neighbors(NEIGHBORS);
+	unsigned int N = this->problem->get_size();
+
+	// Phase 1: a first tour, improved from every node
+	TSPSolution first(this->problem, rng);
+	vector<Node> best = first.get_path();
+	double best_cost = first.get_solution_cost() + descend(&best[0], NULL, 0);
+
+	if (this->verbose) {
+		cout << " Start: " << best_cost << endl;
+	}
+
+	// Phase 2: kick the best tour and improve it around the kick
+	vector<Node> tour = best;
+	unsigned int i = 0;	// current itereation
+	while ((N >= 8) && (i < this->iterations_limit) \
+			&& (current_timestamp() - t_start < this->time_limit)) {
+		Node ends[6];
+		double cost = best_cost + kick(&tour[0], rng, ends);
+		cost += descend(&tour[0], ends, 6);
+
+		if (cost < best_cost - 1e-9) {
+			best = tour;
+			best_cost = cost;
+		} else {
+			tour = best;
+		}
+
+		if (this->verbose && (i > 0) && (i % 1000) == 0) {
+			cout << " Iteration " << i << ": Best: " << best_cost << endl;
+		}
+		i++;
+	}
+
+	if (this->verbose) {
+		cout << " End (itertion: " << i << "): Best: " << best_cost << endl;
+	}
+
+	return new TSPSolution(this->problem, best, best_cost);
+}
+
+/**
+*	@brief	Improve <tour> with LK (symmetric problems) and Or-opt
+*			moves, starting from the <count> nodes in <starts>
+*			(every node if count is 0), until none of them improves it.
+*
+*	@return the change of the tour cost (<= 0)
+*/
+double LKSolver::descend(Node* tour, const Node* starts, unsigned int count) {
+	unsigned int N = this->problem->get_size();
+	double total = 0;
+	double delta;
+	do {
+		delta = 0;
+		if (this->problem->is_symmetric()) {
+			this->lk.load(this->problem, tour);
+			if (count == 0) { this->lk.activate_positions(0, N - 1); }
+			for (unsigned int k = 0; k < count; k++) { this->lk.activate(starts[k]); }
+			delta += this->lk.optimize();
+		}
+
+		this->or_opt.load(this->problem, tour);
+		if (count == 0) { this->or_opt.activate_positions(0, N - 1); }
+		for (unsigned int k = 0; k < count; k++) { this->or_opt.activate(starts[k]); }
+		delta += this->or_opt.optimize();
+
+		total += delta;
+	} while (delta < 0);
+
+	return total;
+}
+
+/**
+*	@brief	Perturb <tour> with a double bridge move: two consecutive
+*			segments, within KICK_WINDOW positions, swap their places
+*			(A B C D becomes A C B D, no segment is reversed).
+*			The nodes at the ends of the changed edges go in <ends>.
+*
+*	@return the change of the tour cost
+*/
+double LKSolver::kick(Node* tour, RandomEngine& rng, Node* ends) {
+	unsigned int N = this->problem->get_size();
+	unsigned int W = std::min(N - 1, KICK_WINDOW);
+
+	// B = [a, b), C = [b, c), all in [1, N-1]
+	unsigned int a = 1 + rng.uniform_int(N - W);
+	unsigned int u = 1 + rng.uniform_int(W - 1);
+	unsigned int v = 1 + rng.uniform_int(W - 1);
+	while (v == u) { v = 1 + rng.uniform_int(W - 1); }
+	unsigned int b = a + std::min(u, v);
+	unsigned int c = a + std::max(u, v);
+
+	ends[0] = tour[a - 1];
+	ends[1] = tour[a];
+	ends[2] = tour[b - 1];
+	ends[3] = tour[b];
+	ends[4] = tour[c - 1];
+	ends[5] = tour[c];
+
+	double delta = this->problem->cost(ends[0], ends[3]) \
+				+ this->problem->cost(ends[4], ends[1]) \
+				+ this->problem->cost(ends[2], ends[5]) \
+				- this->problem->cost(ends[0], ends[1]) \
+				- this->problem->cost(ends[2], ends[3]) \
+				- this->problem->cost(ends[4], ends[5]);
+
+	std::rotate(tour + a, tour + b, tour + c);
+	return delta;
+}
+
+/**
+*	@brief	Get time in milliseconds
+*
+*	@return return time [milliseconds]
+*/
+long long LKSolver::current_timestamp() {
+    struct timeval te;
+    gettimeofday(&te, NULL);	// get current time
+    long long milliseconds = te.tv_sec*1000LL + te.tv_usec/1000;	// caculate milliseconds
+    return milliseconds;
+}
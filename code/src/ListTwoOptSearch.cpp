@@ -0,0 +1,91 @@
+/**
+ *  @file    ListTwoOptSearch.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief 2-opt local search on a two-level list, class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  A 2-opt local search on a two-level doubly-linked list
+ *	(see ListTwoOptSearch.h).
+ *
+ */
+
+#include "../include/ListTwoOptSearch.h"
+
+using namespace std;
+
+/**
+*	@brief	Start working on <path> (N+1 nodes, 0 at both ends)
+*
+*	@return void
+*/
+void ListTwoOptSearch::load(TSPProblem* problem, Node* path) {
+	LocalSearch::load(problem, path);
+	this->tour.load(path, this->N);
+}
+
+/**
+*	@brief	Write the tour back in the buffer given to load()
+*
+*	@return void
+*/
+void ListTwoOptSearch::store() {
+	this->tour.store(this->path);
+	update_positions(0, this->N - 1);
+}
+
+/**
+*	@brief	Look for an improving move removing one of the two edges
+*			of node <a>, and apply the first one found.
+*
+*	@section DESCRIPTION
+*	As in TwoOptSearch::improve_node(): edge (a,b) is replaced by
+*	(a,c), c a neighbor of a, and the edge (c,d) on the same side of c
+*	by (b,d). The move reverses the path from b to c (side 0) or from
+*	c to b (side 1).
+*
+*	@return true if the tour changed (<delta> is updated)
+*/
+bool ListTwoOptSearch::improve_node(Node a, double& delta) {
+	const Node* first = this->problem->get_neighbors().begin(a);
+	const Node* last = this->problem->get_neighbors().end(a);
+
+	for (int side = 0; side < 2; side++) {
+		// edge (a,b): b follows a (side 0) or precedes it (side 1)
+		Node b = (side == 0) ? this->tour.next(a) : this->tour.prev(a);
+		double d_ab = this->problem->cost(a, b);
+
+		for (const Node* it = first; it != last; ++it) {
+			Node c = *it;
+			double g1 = d_ab - this->problem->cost(a, c);
+			if (g1 <= EPSILON) { break; }
+
+			Node d = (side == 0) ? this->tour.next(c) : this->tour.prev(c);
+			if ((c == b) || (d == a)) { continue; }	// adjacent edges
+
+			double gain = g1 + this->problem->cost(c, d) - this->problem->cost(b, d);
+			if (gain > EPSILON) {
+				toggle_edge(a, b);
+				toggle_edge(c, d);
+				toggle_edge(a, c);
+				toggle_edge(b, d);
+				if (side == 0) {
+					this->tour.reverse(b, c);
+				} else {
+					this->tour.reverse(c, b);
+				}
+				delta -= gain;
+
+				activate(a);
+				activate(b);
+				activate(c);
+				activate(d);
+				return true;
+			}
+		}
+	}
+	return false;
+}
@@ -0,0 +1,119 @@
+/**
+ *  @file    LocalSearch.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Local search base class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  Common part of the local searches working in place on a tour
+ *	buffer: node positions, don't look bits and the queue of the
+ *	nodes to look at.
+ *
+ */
+
+#include <algorithm>
+#include "../include/LocalSearch.h"
+
+using namespace std;
+
+constexpr double LocalSearch::EPSILON;
+
+/**
+*	@brief	Default contructor (nothing loaded)
+*/
+LocalSearch::LocalSearch() {
+	this->problem = NULL;
+	this->path = NULL;
+	this->N = 0;
+	this->queue_head = 0;
+	this->queue_count = 0;
+	this->symmetric = true;
+	this->hash_delta = 0;
+}
+
+/**
+*	@brief	Start working on <path> (N+1 nodes, 0 at both ends),
+*			with every don't look bit on.
+*			Buffers are reused from one path to the next.
+*
+*	@return void
+*/
+void LocalSearch::load(TSPProblem* problem, Node* path) {
+	this->problem = problem;
+	this->path = path;
+	this->N = problem->get_size();
+	this->symmetric = problem->is_symmetric();
+
+	this->position.resize(this->N);
+	update_positions(0, this->N - 1);
+	this->active.assign(this->N, 0);
+	this->queue.resize(this->N);
+	this->queue_head = 0;
+	this->queue_count = 0;
+	this->hash_delta = 0;
+}
+
+/**
+*	@brief	Refresh the position of the nodes in positions [from, to]
+*
+*	@return void
+*/
+void LocalSearch::update_positions(unsigned int from, unsigned int to) {
+	for (unsigned int i = from; i <= to; i++) {
+		this->position[this->path[i]] = i;
+	}
+}
+
+/**
+*	@brief	Turn off the don't look bit of node <n>
+*
+*	@return void
+*/
+void LocalSearch::activate(Node n) {
+	if (this->active[n]) { return; }
+	this->active[n] = 1;
+	this->queue[(this->queue_head + this->queue_count) % this->N] = n;
+	this->queue_count++;
+}
+
+/**
+*	@brief	Turn off the don't look bits of the nodes
+*			in positions [from, to] of the path
+*
+*	@return void
+*/
+void LocalSearch::activate_positions(unsigned int from, unsigned int to) {
+	to = std::min(to, this->N);
+	for (unsigned int i = from; i <= to; i++) {
+		activate(this->path[i]);
+	}
+}
+
+/**
+*	@brief	Apply improving moves until no active node is left
+*			or <budget> nodes have been examined (0: no limit).
+*
+*	@return the change of the tour cost (<= 0)
+*/
+double LocalSearch::optimize(unsigned int budget) {
+	double delta = 0;
+	if ((this->N < 5) || (this->problem->get_neighbors().size() == 0)) {
+		return delta;
+	}
+
+	unsigned int examined = 0;
+	while ((this->queue_count > 0) && ((budget == 0) || (examined < budget))) {
+		Node a = this->queue[this->queue_head];
+		this->queue_head = (this->queue_head + 1) % this->N;
+		this->queue_count--;
+		this->active[a] = 0;
+		examined++;
+
+		// if it improves, <a> is active again and will be looked at later
+		improve_node(a, delta);
+	}
+	return delta;
+}
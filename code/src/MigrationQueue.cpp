@@ -0,0 +1,111 @@
+/**
+ *  @file    MigrationQueue.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Migration queue class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  A bounded lock-free queue of tours, used to move individuals
+ *	between islands. Any island can push (multi-producer), the
+ *	owner pops; nobody ever waits: a push on a full queue or a pop
+ *	on an empty one just fails.
+ *
+ */
+
+#include <algorithm>
+#include "../include/MigrationQueue.h"
+
+using namespace std;
+
+namespace {
+	size_t next_power_of_two(size_t n) {
+		size_t p = 2;
+		while (p < n) { p <<= 1; }
+		return p;
+	}
+}
+
+/**
+*	@brief	Default contructor: room for <capacity> tours (rounded up
+*			to a power of two) of <tour_length> nodes each.
+*/
+MigrationQueue::MigrationQueue(unsigned int capacity, unsigned int tour_length) \
+		: cells(next_power_of_two(capacity)) {
+	this->mask = this->cells.size() - 1;
+	for (size_t i = 0; i < this->cells.size(); i++) {
+		this->cells[i].sequence.store(i, std::memory_order_relaxed);
+		this->cells[i].tour.resize(tour_length);
+		this->cells[i].fitness = 0;
+	}
+	this->push_position.store(0, std::memory_order_relaxed);
+	this->pop_position.store(0, std::memory_order_relaxed);
+}
+
+/**
+*	@brief	Copy a tour (and its fitness) into the queue
+*
+*	@return false if the queue is full (the tour is dropped)
+*/
+bool MigrationQueue::push(const Node* tour, double fitness) {
+	Cell* cell;
+	size_t position = this->push_position.load(std::memory_order_relaxed);
+
+	while (1) {
+		cell = &this->cells[position & this->mask];
+		size_t sequence = cell->sequence.load(std::memory_order_acquire);
+		long diff = (long) sequence - (long) position;
+
+		if (diff == 0) {
+			// the cell is free in this turn: try to claim it
+			if (this->push_position.compare_exchange_weak(position, position + 1, \
+														std::memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			return false;	// full
+		} else {
+			position = this->push_position.load(std::memory_order_relaxed);
+		}
+	}
+
+	std::copy(tour, tour + cell->tour.size(), cell->tour.begin());
+	cell->fitness = fitness;
+	cell->sequence.store(position + 1, std::memory_order_release);	// publish
+	return true;
+}
+
+/**
+*	@brief	Copy the oldest tour (and its fitness) out of the queue
+*
+*	@return false if the queue is empty
+*/
+bool MigrationQueue::pop(Node* tour, double& fitness) {
+	Cell* cell;
+	size_t position = this->pop_position.load(std::memory_order_relaxed);
+
+	while (1) {
+		cell = &this->cells[position & this->mask];
+		size_t sequence = cell->sequence.load(std::memory_order_acquire);
+		long diff = (long) sequence - (long) (position + 1);
+
+		if (diff == 0) {
+			// the cell is full in this turn: try to claim it
+			if (this->pop_position.compare_exchange_weak(position, position + 1, \
+														std::memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			return false;	// empty
+		} else {
+			position = this->pop_position.load(std::memory_order_relaxed);
+		}
+	}
+
+	std::copy(cell->tour.begin(), cell->tour.end(), tour);
+	fitness = cell->fitness;
+	cell->sequence.store(position + this->mask + 1, std::memory_order_release);	// free for the next turn
+	return true;
+}
@@ -0,0 +1,208 @@
+/**
+ *  @file    NeighborLists.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Neighbor lists class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  The k nearest neighbors of every node of a problem, closest
+ *	first, in a compressed (CSR) layout.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "../include/NeighborLists.h"
+#include "../include/ThreadPool.h"
+
+using namespace std;
+
+/**
+*	@brief	Default contructor (no lists)
+*/
+NeighborLists::NeighborLists() {
+	this->k = 0;
+}
+
+/**
+*	@brief	Make room for <k> neighbors of each of the N nodes
+*
+*	@return void
+*/
+void NeighborLists::resize(unsigned int N, unsigned int k) {
+	this->k = k;
+	this->start.resize(N + 1);
+	for (unsigned int i = 0; i <= N; i++) {
+		this->start[i] = i * k;
+	}
+	this->list.resize((size_t) N * k);
+}
+
+/**
+*	@brief	Run body(from, to) over the nodes [0, N), in chunks on
+*			<threads> threads when the problem is large enough.
+*
+*	@return void
+*/
+void NeighborLists::for_each_node(unsigned int N, unsigned int threads, std::function<void(unsigned int, unsigned int)> body) {
+	if ((N < PARALLEL_SIZE) || (threads <= 1)) {
+		body(0, N);
+		return;
+	}
+
+	ThreadPool workers(threads);
+	workers.parallel_for((N + CHUNK_SIZE - 1) / CHUNK_SIZE, [&](unsigned int c, unsigned int) {
+		body(c * CHUNK_SIZE, std::min(N, (c + 1) * CHUNK_SIZE));
+	});
+}
+
+/**
+*	@brief	Build the lists from the rows of the cost matrix:
+*			a partial sort of each row, O(N log k) per node.
+*			Ties are broken by node index.
+*
+*	@return void
+*/
+void NeighborLists::build_from_costs(const TSPProblem& problem, unsigned int k, unsigned int threads) {
+	unsigned int N = problem.get_size();
+	resize(N, std::min(k, (N > 0) ? N - 1 : 0));
+	k = this->k;
+
+	const double* costs = problem.get_costs();
+	for_each_node(N, threads, [&](unsigned int from, unsigned int to) {
+		vector<Node> order(N);
+		for (unsigned int i = from; i < to; ++i) {
+			const double* row = costs + (size_t) i * N;
+			for (unsigned int j = 0; j < N; ++j) { order[j] = j; }
+			std::swap(order[i], order[N-1]);	// i is not a neighbor of itself
+
+			std::partial_sort(order.begin(), order.begin() + k, order.end() - 1, \
+							[row](Node a, Node b) { return (row[a] < row[b]) || ((row[a] == row[b]) && (a < b)); });
+			std::copy(order.begin(), order.begin() + k, this->list.begin() + this->start[i]);
+		}
+	});
+}
+
+/**
+*	@brief	Build the lists from the coordinates of the nodes
+*			(euclidean distances).
+*
+*	@section DESCRIPTION
+*	Points are bucketed in a uniform grid of about N/2 square cells.
+*	The neighbors of a node are looked for in rings of cells around
+*	its own: once k candidates are known, the search stops at the first
+*	ring that cannot hold anything closer than the k-th one.
+*	Each row of cells of a ring is one span of the points sorted by
+*	cell, so the distances come from the vectorized kernel of TSPProblem
+*	(the same values as cost()).
+*	Ties are broken by node index, as in build_from_costs().
+*
+*	@return void
+*/
+void NeighborLists::build_from_points(const vector<double>& x, const vector<double>& y, unsigned int k, unsigned int threads) {
+	unsigned int N = x.size();
+	resize(N, std::min(k, (N > 0) ? N - 1 : 0));
+	k = this->k;
+	if (k == 0) { return; }
+
+	// Grid: cells of side <side>, gx * gy of them
+	double min_x = *min_element(x.begin(), x.end());
+	double min_y = *min_element(y.begin(), y.end());
+	double width = *max_element(x.begin(), x.end()) - min_x;
+	double height = *max_element(y.begin(), y.end()) - min_y;
+
+	double cells = std::max(1u, N / 2);
+	double side = std::max(sqrt(width * height / cells), std::max(width, height) / cells);
+	if (side <= 0) { side = 1; }	// all the points in the same place
+	int gx = (int) (width / side) + 1;
+	int gy = (int) (height / side) + 1;
+
+	auto cell_x = [&](Node j) { return std::min(gx - 1, (int) ((x[j] - min_x) / side)); };
+	auto cell_y = [&](Node j) { return std::min(gy - 1, (int) ((y[j] - min_y) / side)); };
+
+	// Nodes sorted by cell (counting sort): cell c holds cell_nodes[cell_start[c], cell_start[c+1]),
+	// and their coordinates are copied in the same order. Cells next to each other in a
+	// row of the grid are next to each other in these arrays.
+	vector<unsigned int> cell_start((size_t) gx * gy + 1, 0);
+	vector<Node> cell_nodes(N);
+	vector<double> cell_px(N);
+	vector<double> cell_py(N);
+	for (unsigned int j = 0; j < N; j++) {
+		cell_start[(size_t) cell_y(j) * gx + cell_x(j) + 1]++;
+	}
+	for (size_t c = 0; c + 1 < cell_start.size(); c++) {
+		cell_start[c + 1] += cell_start[c];
+	}
+	{
+		vector<unsigned int> fill(cell_start.begin(), cell_start.end() - 1);
+		for (unsigned int j = 0; j < N; j++) {
+			unsigned int n = fill[(size_t) cell_y(j) * gx + cell_x(j)]++;
+			cell_nodes[n] = j;
+			cell_px[n] = x[j];
+			cell_py[n] = y[j];
+		}
+	}
+
+	for_each_node(N, threads, [&](unsigned int from, unsigned int to) {
+		vector< pair<double, Node> > best;	// max-heap of the k closest so far
+		best.reserve(k + 1);
+		vector<double> distance;	// scratch: distances to a span of cells
+
+		for (unsigned int i = from; i < to; ++i) {
+			best.clear();
+			int cx = cell_x(i);
+			int cy = cell_y(i);
+
+			// candidates in cells [x0, x1] of grid row <row>: one span of the arrays
+			auto scan = [&](int row, int x0, int x1) {
+				x0 = std::max(x0, 0);
+				x1 = std::min(x1, gx - 1);
+				if ((row < 0) || (row >= gy) || (x0 > x1)) { return; }
+
+				unsigned int first = cell_start[(size_t) row * gx + x0];
+				unsigned int count = cell_start[(size_t) row * gx + x1 + 1] - first;
+				if (distance.size() < count) { distance.resize(count); }
+				TSPProblem::distances(&cell_px[first], &cell_py[first], count, x[i], y[i], &distance[0]);
+
+				for (unsigned int n = 0; n < count; n++) {
+					Node j = cell_nodes[first + n];
+					if (j == (Node) i) { continue; }
+					pair<double, Node> candidate(distance[n], j);
+
+					if (best.size() < k) {
+						best.push_back(candidate);
+						std::push_heap(best.begin(), best.end());
+					} else if (candidate < best.front()) {
+						std::pop_heap(best.begin(), best.end());
+						best.back() = candidate;
+						std::push_heap(best.begin(), best.end());
+					}
+				}
+			};
+
+			for (int r = 0; ; r++) {
+				// cells at distance r (in cells) from the node's one:
+				// the whole first and last rows, the two ends of the others
+				scan(cy - r, cx - r, cx + r);
+				for (int dy = -r + 1; dy < r; dy++) {
+					scan(cy + dy, cx - r, cx - r);
+					scan(cy + dy, cx + r, cx + r);
+				}
+				if (r > 0) { scan(cy + r, cx - r, cx + r); }
+
+				// next rings are at least r * side away
+				double reach = r * side;
+				if ((best.size() == k) && (reach >= best.front().first)) { break; }
+				if ((r > gx) && (r > gy)) { break; }
+			}
+
+			std::sort_heap(best.begin(), best.end());
+			for (unsigned int n = 0; n < k; n++) {
+				this->list[this->start[i] + n] = best[n].second;
+			}
+		}
+	});
+}
@@ -0,0 +1,148 @@
+/**
+ *  @file    OrOptSearch.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Or-opt local search class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  An Or-opt local search working in place on a tour buffer
+ *	(see LocalSearch).
+ *
+ */
+
+#include <algorithm>
+#include "../include/OrOptSearch.h"
+
+using namespace std;
+
+/**
+*	@brief	Look for an improving move of a segment starting
+*			or ending in node <a>, and apply the first one found.
+*
+*	@return true if the tour changed (<delta> is updated)
+*/
+bool OrOptSearch::improve_node(Node a, double& delta) {
+	unsigned int pa = this->position[a];
+	if (pa == 0) { return false; }	// node 0 never moves
+
+	for (unsigned int L = 1; L <= MAX_SEGMENT; L++) {
+		// segment [pa, pa+L-1] and [pa-L+1, pa] (the same one if L = 1)
+		if ((pa + L - 1 <= this->N - 1) && improve_segment(pa, pa + L - 1, delta)) {
+			return true;
+		}
+		if ((L > 1) && (pa >= L) && improve_segment(pa - L + 1, pa, delta)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+*	@brief	Look for an improving place for the segment in positions
+*			[i, j] (1 <= i <= j <= N-1), and move it there.
+*
+*	@section DESCRIPTION
+*	Taking the segment s1..s2 out of p-s1..s2-n saves
+*		C_p,s1 + C_s2,n - C_p,n
+*	and putting it in the edge (x,y) costs
+*		C_x,s1 + C_s2,y - C_x,y	(as it is)
+*		C_x,s2 + C_s1,y - C_x,y	(reversed, plus the change of the inner edges).
+*	Places are looked for next to the neighbors c of s1 and s2,
+*	stopping as soon as the edge to c costs more than the saving.
+*
+*	@return true if the tour changed (<delta> is updated)
+*/
+bool OrOptSearch::improve_segment(unsigned int i, unsigned int j, double& delta) {
+	Node s1 = this->path[i];
+	Node s2 = this->path[j];
+	Node p = this->path[i - 1];
+	Node n = this->path[j + 1];
+
+	double removal = this->problem->cost(p, s1) + this->problem->cost(s2, n) - this->problem->cost(p, n);
+	if (removal <= EPSILON) { return false; }
+
+	// inner edges: reversed minus as they are (0 if symmetric)
+	double reversal = 0;
+	for (unsigned int k = i; k < j; k++) {
+		reversal += this->problem->cost(this->path[k + 1], this->path[k]) \
+					- this->problem->cost(this->path[k], this->path[k + 1]);
+	}
+
+	const NeighborLists& neighbors = this->problem->get_neighbors();
+	for (int end = 0; end < 2; end++) {
+		Node s = (end == 0) ? s1 : s2;
+
+		for (const Node* it = neighbors.begin(s); it != neighbors.end(s); ++it) {
+			Node c = *it;
+			if (removal - this->problem->cost(s, c) <= EPSILON) { break; }
+			if ((this->position[c] >= i) && (this->position[c] <= j)) { continue; }	// in the segment
+
+			// c-s1 (as it is, after c) and s1-c (reversed, before c),
+			// or s2-c (as it is, before c) and c-s2 (reversed, after c)
+			for (int reversed = 0; reversed < 2; reversed++) {
+				bool after_c = ((end == 0) == (reversed == 0));
+				unsigned int e = after_c ? edge_after(c) : edge_before(c);
+				if ((e + 1 >= i) && (e <= j)) { continue; }	// the edges around the segment
+
+				Node x = this->path[e];
+				Node y = this->path[e + 1];
+				double insertion = (reversed == 0) ? \
+						this->problem->cost(x, s1) + this->problem->cost(s2, y) : \
+						this->problem->cost(x, s2) + this->problem->cost(s1, y) + reversal;
+				insertion -= this->problem->cost(x, y);
+
+				double gain = removal - insertion;
+				if (gain > EPSILON) {
+					apply_move(i, j, e, reversed == 1);
+					delta -= gain;
+
+					activate(p);
+					activate(n);
+					activate(x);
+					activate(y);
+					activate(s1);
+					activate(s2);
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+/**
+*	@brief	Move the segment in positions [i, j] into edge <e>
+*			(outside [i-1, j]), reversing it if asked.
+*			Only the nodes between the old and the new place move.
+*
+*	@return void
+*/
+void OrOptSearch::apply_move(unsigned int i, unsigned int j, unsigned int e, bool reversed) {
+	Node s1 = this->path[i];
+	Node s2 = this->path[j];
+	toggle_edge(this->path[i - 1], s1);
+	toggle_edge(s2, this->path[j + 1]);
+	toggle_edge(this->path[e], this->path[e + 1]);
+	toggle_edge(this->path[i - 1], this->path[j + 1]);
+	toggle_edge(this->path[e], reversed ? s2 : s1);
+	toggle_edge(reversed ? s1 : s2, this->path[e + 1]);
+
+	if (reversed) {
+		for (unsigned int k = i; (k < j) && !this->symmetric; k++) {	// inner edges go the other way
+			toggle_edge(this->path[k], this->path[k + 1]);
+			toggle_edge(this->path[k + 1], this->path[k]);
+		}
+		std::reverse(this->path + i, this->path + j + 1);
+	}
+
+	if (e > j) {
+		std::rotate(this->path + i, this->path + j + 1, this->path + e + 1);
+		update_positions(i, e);
+	} else {
+		std::rotate(this->path + e + 1, this->path + i, this->path + j + 1);
+		update_positions(e + 1, j);
+	}
+}
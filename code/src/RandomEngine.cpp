@@ -0,0 +1,91 @@
+/**
+ *  @file    RandomEngine.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Random engine class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  A small and fast pseudo-random generator (xoshiro256**).
+ *	Unlike rand() it has no global state: each solver (or thread)
+ *	owns its engine, so sequences are reproducible from a seed.
+ *
+ */
+
+#include "../include/RandomEngine.h"
+
+namespace {
+	// splitmix64: spreads a seed over the whole state
+	uint64_t splitmix64(uint64_t& x) {
+		uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	}
+}
+
+/**
+*	@brief	Default contructor
+*/
+RandomEngine::RandomEngine(uint64_t seed) {
+	this->seed(seed);
+}
+
+/**
+*	@brief	(Re)start the sequence from <seed>
+*
+*	@return void
+*/
+void RandomEngine::seed(uint64_t seed) {
+	for (int i = 0; i < 4; i++) {
+		state[i] = splitmix64(seed);
+	}
+}
+
+/**
+*	@brief	(Re)start the sequence number <stream> of <seed>:
+*			different streams of the same seed are independent.
+*
+*	@return void
+*/
+void RandomEngine::seed(uint64_t seed, uint64_t stream) {
+	uint64_t mixed = stream;
+	this->seed(seed ^ splitmix64(mixed));
+}
+
+/**
+*	@brief	Fill <out> with <count> uniform integers in [0, n), n > 0
+*
+*	@return void
+*/
+void RandomEngine::uniform_ints(unsigned int n, unsigned int* out, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		out[i] = uniform_int(n);
+	}
+}
+
+/**
+*	@brief	Fill <out> with <count> uniform real numbers in [0, 1)
+*
+*	@return void
+*/
+void RandomEngine::uniform_doubles(double* out, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		out[i] = uniform_double();
+	}
+}
+
+/**
+*	@brief	A seed for the independent stream number <stream>,
+*			e.g. to give a separate engine to each island.
+*			The state of this engine is not changed.
+*
+*	@return a seed
+*/
+uint64_t RandomEngine::derive_seed(uint64_t stream) {
+	RandomEngine child(this->state[0] ^ this->state[2]);
+	child.seed(this->state[1] ^ this->state[3], stream);
+	return child.next();
+}
@@ -0,0 +1,131 @@
+/**
+ *  @file    RouletteReplacement.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Roulette replacement class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  Replacement operator of the GA: the new generation is drawn
+ *	from the old one and the offspring, one Montecarlo pick at a
+ *	time, without replacement.
+ *
+ */
+
+#include <algorithm>
+#include "../include/RouletteReplacement.h"
+
+using namespace std;
+
+/**
+*	@brief	Merge the old population with the offspring and produce a new generation.
+*
+*	@section DESCRIPTION
+*	Method used: selection of the bests.
+*	<size> individuals are selected from a pool of N+R individuals where
+*	R is the dimension of the offspring.
+*	The slots of the individuals left out are put in <discarded>.
+*
+*	Each pick is the one of GAPopulation::montecarlo_selection() over the
+*	individuals not selected yet, without re-sorting them every time: the
+*	pool is sorted once and the weights of the ranks are kept in a Fenwick
+*	tree, so the whole selection costs O((N+R) log(N+R)).
+*
+*	@return void
+*/
+void RouletteReplacement::replace(vector<Slot>& population, const vector<Slot>& offspring, \
+								const vector<double>& fitness, unsigned int size, \
+								RandomEngine& rng, vector<Slot>& discarded) {
+	// Create a new (provisional) population with the old one and the offspring
+	this->candidates.assign( population.begin(), population.end() );
+	this->candidates.insert( this->candidates.end(), offspring.begin(), offspring.end() );
+
+	// Sort the candidates by their fitness value (once)
+	const vector<double>& f = fitness;
+	std::sort(this->candidates.begin(), this->candidates.end(), \
+			[&f](Slot a, Slot b) { return f[a] < f[b]; });
+
+	// Candidates still to be selected, in order of fitness
+	int m = this->candidates.size();
+	int first = 0;
+	this->next_rank.resize(m);
+	this->prev_rank.resize(m);
+	for (int r = 0; r < m; r++) {
+		this->next_rank[r] = (r + 1 < m) ? r + 1 : -1;
+		this->prev_rank[r] = r - 1;
+	}
+
+	this->rank_weight.resize(m);
+	for (int r = 0; r < m; r++) {
+		this->rank_weight[r] = selection_weight(fitness, r, first);
+	}
+	this->roulette.reset(this->rank_weight);
+
+	// Choose the random numbers k s.t. 0<=k<1 (one per pick)
+	this->selection_draws.resize(size);
+	rng.uniform_doubles(&this->selection_draws[0], size);
+
+	population.clear();
+	for (unsigned int i = 0; i < size; i++) {
+		double k = this->selection_draws[i];
+		int selected = this->roulette.find(k * this->roulette.total());
+		if ((selected >= m) || (this->rank_weight[selected] <= 0)) {
+			selected = first;	// rounding at the end of the wheel
+		}
+
+		// Add the individual to the new population
+		population.push_back(this->candidates[selected]);
+
+		// Remove the individual from the candidates:
+		// only its neighbors' weights change
+		int prev = this->prev_rank[selected];
+		int next = this->next_rank[selected];
+		if (prev >= 0) { this->next_rank[prev] = next; } else { first = next; }
+		if (next >= 0) { this->prev_rank[next] = prev; }
+
+		this->roulette.add(selected, -this->rank_weight[selected]);
+		this->rank_weight[selected] = 0;
+		if (prev >= 0) { update_selection_weight(fitness, prev, first); }
+		if (next >= 0) { update_selection_weight(fitness, next, first); }
+	}
+
+	// Whoever was not selected is discarded
+	discarded.clear();
+	for (int r = first; r >= 0; r = this->next_rank[r]) {
+		discarded.push_back(this->candidates[r]);
+	}
+}
+
+/**
+*	@brief	Weight of the candidate with rank <rank> in the selection,
+*			given the ranks still linked (<first> is the best one).
+*
+*	@section DESCRIPTION
+*	montecarlo_selection() scans the sorted pool until the cumulative
+*	probability reaches k and picks the element *before* the one that
+*	reached it. So a candidate is picked with the probability of the one
+*	following it, the best one also with its own, and the last one never.
+*
+*	@return a (non normalized) weight
+*/
+double RouletteReplacement::selection_weight(const vector<double>& fitness, int rank, int first) const {
+	int next = this->next_rank[rank];
+	double w = (next >= 0) ? fitness[this->candidates[next]] : 0;
+	if (rank == first) {
+		w += fitness[this->candidates[rank]];
+	}
+	return w;
+}
+
+/**
+*	@brief	Refresh the weight of rank <rank> in the roulette
+*
+*	@return void
+*/
+void RouletteReplacement::update_selection_weight(const vector<double>& fitness, int rank, int first) {
+	double w = selection_weight(fitness, rank, first);
+	this->roulette.add(rank, w - this->rank_weight[rank]);
+	this->rank_weight[rank] = w;
+}
@@ -14,73 +14,466 @@
  */
 
 #include "../include/TSPProblem.h"
+#include "../include/NeighborLists.h"
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <stdint.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using namespace std;
 
+/*
+	Binary instance format (".tspb"), native byte order:
+
+		offset  0: BinaryHeader (64 bytes)
+		offset 64: payload, doubles
+			- full:   N*N costs, row-major (used in place, no copy)
+			- packed: N*(N-1)/2 costs C_i,j with i < j, row-major
+			          (symmetric matrices with a zero diagonal)
+
+	The checksum is a 64-bit FNV-1a computed over the payload words.
+*/
+namespace {
+	const char BINARY_MAGIC[4] = { 'T', 'S', 'P', 'B' };
+	const uint32_t BINARY_VERSION = 1;
+	const uint32_t BINARY_PACKED = 1;	// flags: upper triangle only
+
+	struct BinaryHeader {
+		char magic[4];
+		uint32_t version;
+		uint32_t N;
+		uint32_t flags;
+		uint64_t payload_bytes;
+		uint64_t checksum;
+		char reserved[32];	// pad to 64 bytes, keeps the payload aligned
+	};
+
+	uint64_t payload_checksum(const double* data, size_t count) {
+		const uint64_t* words = reinterpret_cast<const uint64_t*>(data);
+		uint64_t hash = 14695981039346656037ULL;
+		for (size_t k = 0; k < count; ++k) {
+			hash ^= words[k];
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+}
+
  /**
  *	@brief	Random instances constructor
  *
  *	@section DESCRIPTION
  *	Create a random instance of a problem with a dimension of N.
  *	Costs are randomly generated within a range of 0-100,
- *	preserving matrix simmetry.
+ *	preserving matrix simmetry. The same seed gives the same instance.
  */
-TSPProblem::TSPProblem(unsigned int N) {
+TSPProblem::TSPProblem(unsigned int N, uint64_t seed) {
 	this->N = N;
+	mapping = NULL;
+	mapping_size = 0;
+	symmetric = true;
+	neighbor_lists = new NeighborLists();
+	threads = 1;
 	nodes.reserve(N);	// make space for the nodes and then create them
 	for (unsigned int i = 0; i < N; ++i) { nodes.push_back(i); }
 
-	this->C.resize(N);
-	srand(time(NULL));
+	allocate_costs();
+	RandomEngine rng(seed);
 
 	for (unsigned int i = 0; i < N; ++i) {
-		if (C[i].size() == 0) { C[i].resize(N); }
-		C[i][i] = 0; // fill the diagonal with zeros
+		C[(size_t) i * N + i] = 0; // fill the diagonal with zeros
 		for (unsigned int j = i+1; j < N; j++){
-			C[i][j] = rand() % 99 +1;	// C_i,j: random cost (non negative)
-			if (C[j].size() == 0) { C[j].resize(N); }
-			C[j][i] = C[i][j];	// it's a Symmetric matrix, so C_j,i = C_i,j
+			C[(size_t) i * N + j] = rng.uniform_int(99) +1;	// C_i,j: random cost (non negative)
+			C[(size_t) j * N + i] = C[(size_t) i * N + j];	// it's a Symmetric matrix, so C_j,i = C_i,j
 		}
 	}
+	compute_cost_bounds();
 }
 
 /**
 *	@brief	(constructor) Load an istance from a file
+*
+*	@section DESCRIPTION
+*	Three formats are accepted, detected from the first bytes:
+*	- a binary instance (see save_binary()), mapped in memory;
+*	- a dense matrix (generated by scripts/gen_instances.py): N followed by N*N costs;
+*	- a TSPLIB file with a NODE_COORD_SECTION (e.g. vlsi-dataset/):
+*	  only the coordinates are stored, costs are computed on demand.
 */
 TSPProblem::TSPProblem(string filename) {
-	fstream file(filename, ios_base::in);
-	file >> N;	// read problem dimension value
+	C = NULL;
+	N = 0;
+	mapping = NULL;
+	mapping_size = 0;
+	symmetric = true;
+	neighbor_lists = new NeighborLists();
+	threads = 1;
+
+	if (!load_binary(filename)) {
+		fstream file(filename, ios_base::in);
+		if (!file.is_open()) {
+			throw std::runtime_error("Unable to open instance '" + filename + "'");
+		}
+
+		file >> std::ws;
+		if (isdigit(file.peek())) {
+			load_matrix(file);
+		} else {
+			load_coordinates(file);
+		}
+	}
+	symmetric = check_symmetry();
+	compute_cost_bounds();
 
 	nodes.reserve(N);	// create nodes for the problem
 	for (unsigned int i = 0; i < N; ++i) { nodes.push_back(i); }
-	C.resize(N);
+}
+
+/**
+*	@brief	Read a dense cost matrix: N and then the N*N costs
+*
+*	@return void
+*/
+void TSPProblem::load_matrix(fstream& file) {
+	file >> N;	// read problem dimension value
+	allocate_costs();
+
+	// reads costs from file (row by row, so in buffer order)
+	double* c = C;
+	for (size_t k = 0; k < (size_t) N * N; ++k) {
+		file >> *c++;
+	}
+}
+
+/**
+*	@brief	Read a TSPLIB instance (EUC_2D). The header is a list of
+*			"KEY : VALUE" lines followed by the NODE_COORD_SECTION,
+*			one "id x y" line per node.
+*			Distances are the plain euclidean ones (not rounded to
+*			the nearest integer), as in scripts/gen_instances.py.
+*
+*	@return void
+*/
+void TSPProblem::load_coordinates(fstream& file) {
+	string line;
+	while (getline(file, line)) {
+		size_t sep = line.find(':');
+		string key = line.substr(0, sep);
+		key.erase(key.find_last_not_of(" \t\r") + 1);
+
+		if (key == "NODE_COORD_SECTION") { break; }
+		if (sep == string::npos) { continue; }
+
+		stringstream value(line.substr(sep + 1));
+		if (key == "DIMENSION") {
+			value >> N;
+		} else if (key == "EDGE_WEIGHT_TYPE") {
+			string type;
+			value >> type;
+			if (type != "EUC_2D") {
+				throw std::runtime_error("Unsupported EDGE_WEIGHT_TYPE: " + type);
+			}
+		}
+	}
+
+	if (N == 0) {
+		throw std::runtime_error("Missing DIMENSION or NODE_COORD_SECTION");
+	}
 
-	// reads costs from file
+	X.resize(N);
+	Y.resize(N);
 	for (unsigned int i = 0; i < N; ++i) {
-		C[i].resize(N);
-		for (unsigned int j = 0; j <N; j++){
-			file >> C[i][j];
+		unsigned int id;
+		if (!(file >> id >> X[i] >> Y[i])) {
+			throw std::runtime_error("Truncated NODE_COORD_SECTION");
+		}
+	}
+}
+
+/**
+*	@brief	Map a binary instance in memory.
+*			A full matrix is used in place, a packed one is expanded.
+*
+*	@return false if the file is not a binary instance
+*/
+bool TSPProblem::load_binary(const string& filename) {
+	int fd = open(filename.c_str(), O_RDONLY);
+	if (fd < 0) { return false; }
+
+	BinaryHeader header;
+	struct stat info;
+	if ((fstat(fd, &info) != 0) || (read(fd, &header, sizeof(header)) != (ssize_t) sizeof(header)) \
+			|| (memcmp(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0)) {
+		close(fd);
+		return false;
+	}
+
+	if (header.version != BINARY_VERSION) {
+		close(fd);
+		throw std::runtime_error("Unsupported binary instance version in '" + filename + "'");
+	}
+
+	size_t n = header.N;
+	size_t count = (header.flags & BINARY_PACKED) ? n * (n - 1) / 2 : n * n;
+	if ((header.payload_bytes != count * sizeof(double)) \
+			|| ((size_t) info.st_size < sizeof(header) + header.payload_bytes)) {
+		close(fd);
+		throw std::runtime_error("Truncated binary instance '" + filename + "'");
+	}
+
+	mapping_size = sizeof(header) + header.payload_bytes;
+	mapping = mmap(NULL, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);	// the mapping keeps the file alive
+	if (mapping == MAP_FAILED) {
+		mapping = NULL;
+		throw std::runtime_error("Unable to map binary instance '" + filename + "'");
+	}
+
+	const double* payload = reinterpret_cast<const double*>(static_cast<char*>(mapping) + sizeof(header));
+	if (payload_checksum(payload, count) != header.checksum) {
+		munmap(mapping, mapping_size);
+		mapping = NULL;
+		throw std::runtime_error("Checksum mismatch in binary instance '" + filename + "'");
+	}
+
+	N = header.N;
+	if (header.flags & BINARY_PACKED) {
+		// expand the upper triangle, the mapping is no longer needed
+		allocate_costs();
+		for (size_t i = 0; i < n; ++i) {
+			C[i * n + i] = 0;
+			for (size_t j = i + 1; j < n; ++j) {
+				C[i * n + j] = C[j * n + i] = *payload++;
+			}
 		}
+		munmap(mapping, mapping_size);
+		mapping = NULL;
+	} else {
+		madvise(mapping, mapping_size, MADV_WILLNEED);
+		C = const_cast<double*>(payload);	// read-only from now on
 	}
+
+	return true;
 }
 
 /**
-*   @brief  Return a matrix with the costs of the problem.
+*	@brief	Write the problem as a binary instance.
+*			With <packed> only the upper triangle is stored, but only
+*			if the matrix is symmetric (otherwise it's written in full).
 *
-*   @return costs matrix
+*	@return void
 */
-vector< vector<double> > TSPProblem::get_costs() {
+void TSPProblem::save_binary(const string& filename, bool packed) const {
+	packed = packed && is_symmetric();
+
+	vector<double> payload;
+	payload.reserve(packed ? (size_t) N * (N - 1) / 2 : (size_t) N * N);
+	for (unsigned int i = 0; i < N; ++i) {
+		for (unsigned int j = (packed ? i + 1 : 0); j < N; ++j) {
+			payload.push_back(cost(i, j));
+		}
+	}
+
+	BinaryHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+	header.version = BINARY_VERSION;
+	header.N = N;
+	header.flags = packed ? BINARY_PACKED : 0;
+	header.payload_bytes = payload.size() * sizeof(double);
+	header.checksum = payload_checksum(payload.data(), payload.size());
+
+	ofstream file(filename, ios::out | ios::binary | ios::trunc);
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(payload.data()), header.payload_bytes);
+	if (!file) {
+		throw std::runtime_error("Unable to write binary instance '" + filename + "'");
+	}
+}
+
+/**
+*	@brief	Destructor: release the cost buffer
+*/
+TSPProblem::~TSPProblem() {
+	if (mapping != NULL) {
+		munmap(mapping, mapping_size);	// C points into the mapping
+	} else {
+		free(C);	// no-op for coordinate instances
+	}
+	delete neighbor_lists;
+}
+
+/**
+*	@brief	Allocate the N*N cost buffer, aligned to a cache line
+*			so that each row scan starts on a fresh line.
+*
+*	@return void
+*/
+void TSPProblem::allocate_costs() {
+	void* buffer = NULL;
+	size_t bytes = (size_t) N * N * sizeof(double);
+	if (posix_memalign(&buffer, COSTS_ALIGNMENT, bytes > 0 ? bytes : sizeof(double)) != 0) {
+		throw std::bad_alloc();
+	}
+	C = static_cast<double*>(buffer);
+}
+
+/**
+*   @brief  Return a read-only view of the costs of the problem.
+*			The matrix is stored row-major: C_i,j is at [i*N + j].
+*			No copy is made, use cost(i,j) for single entries.
+*
+*   @return pointer to the costs buffer
+*/
+const double* TSPProblem::get_costs() const {
 	return this->C;
 }
 
+/**
+*   @brief  Euclidean distances from the point (xi, yi) to the <n>
+*			points (x[j], y[j]), into <out>: the same values cost()
+*			gives. The loop works on plain arrays only, so it's
+*			vectorized (see CFLAGS in the Makefile).
+*
+*   @return void
+*/
+void TSPProblem::distances(const double* x, const double* y, unsigned int n, \
+						double xi, double yi, double* out) {
+	const double* __restrict px = x;
+	const double* __restrict py = y;
+	double* __restrict d = out;
+	for (unsigned int j = 0; j < n; ++j) {
+		double dx = xi - px[j];
+		double dy = yi - py[j];
+		d[j] = sqrt(dx * dx + dy * dy);
+	}
+}
+
+/**
+*   @brief  Return an upper bound of the costs from node i:
+*			the max of the row for a matrix, the distance from
+*			the farthest corner of the bounding box otherwise.
+*
+*   @return max_j C_i,j (or an upper bound of it)
+*/
+double TSPProblem::max_cost_from(Node i) const {
+	if (C != NULL) { return row_max[i]; }
+
+	double dx = max(X[i] - min_x, max_x - X[i]);
+	double dy = max(Y[i] - min_y, max_y - Y[i]);
+	return sqrt(dx * dx + dy * dy);
+}
+
+/**
+*   @brief  Compute the bounds used by max_cost_from()
+*
+*   @return void
+*/
+void TSPProblem::compute_cost_bounds() {
+	if (C != NULL) {
+		row_max.assign(N, 0);
+		for (unsigned int i = 0; i < N; ++i) {
+			const double* row = C + (size_t) i * N;
+			row_max[i] = *max_element(row, row + N);
+		}
+	} else if (N > 0) {
+		min_x = *min_element(X.begin(), X.end());
+		max_x = *max_element(X.begin(), X.end());
+		min_y = *min_element(Y.begin(), Y.end());
+		max_y = *max_element(Y.begin(), Y.end());
+	}
+}
+
+/**
+*   @brief  Compute the k nearest neighbors of every node (closest first),
+*			used to restrict the moves of the local searches: from the
+*			coordinates when there are, from the costs otherwise
+*			(see NeighborLists). Lists are kept and shared by every solver:
+*			asking again for k or less neighbors is free.
+*			Not thread safe: call it before starting the workers.
+*
+*   @return void
+*/
+void TSPProblem::build_neighbors(unsigned int k) {
+	k = std::min(k, (N > 0) ? N - 1 : 0);	// no more than N-1 neighbors: cached as well
+	if (k <= this->neighbor_lists->size()) { return; }
+
+	if (has_coordinates()) {
+		this->neighbor_lists->build_from_points(X, Y, k, this->threads);
+	} else {
+		this->neighbor_lists->build_from_costs(*this, k, this->threads);
+	}
+}
+
+/**
+*   @brief  Set the threads that build_neighbors() may use
+*			(the share of the solver running on this problem, default 1)
+*
+*   @return void
+*/
+void TSPProblem::set_threads(unsigned int threads) {
+	this->threads = std::max(1u, threads);
+}
+
+/**
+*   @brief  Return the neighbor lists (empty until build_neighbors())
+*
+*   @return the lists
+*/
+const NeighborLists& TSPProblem::get_neighbors() const {
+	return *this->neighbor_lists;
+}
+
+/**
+*   @brief  Return true if the problem was loaded from coordinates
+*			(costs computed on demand, no matrix in memory)
+*
+*   @return boolean
+*/
+bool TSPProblem::has_coordinates() const {
+	return this->C == NULL;
+}
+
+/**
+*   @brief  Return true if C_i,j = C_j,i for every pair and the diagonal is zero
+*
+*   @return boolean
+*/
+bool TSPProblem::is_symmetric() const {
+	return this->symmetric;
+}
+
+/**
+*   @brief  Scan the matrix to tell if it's symmetric (see is_symmetric())
+*
+*   @return boolean
+*/
+bool TSPProblem::check_symmetry() const {
+	if (has_coordinates()) { return true; }
+
+	for (unsigned int i = 0; i < N; ++i) {
+		if (cost(i, i) != 0) { return false; }
+		for (unsigned int j = i + 1; j < N; ++j) {
+			if (cost(i, j) != cost(j, i)) { return false; }
+		}
+	}
+	return true;
+}
+
 /**
 *   @brief  Return the value of the problem's dimension
 *
 *   @return dimension of the problem
 */
-unsigned int TSPProblem::get_size() {
+unsigned int TSPProblem::get_size() const {
 	return this->N;
 }
 
@@ -100,7 +493,7 @@ void TSPProblem::print_costs() {
 	for (unsigned int i = 0; i < N; ++i) {
 		cout << i <<"\t";
 		for (unsigned int j = 0; j <N; j++){
-			cout << C[i][j]<<"\t";
+			cout << cost(i, j) <<"\t";
 		}
 		cout << endl;
 	}
@@ -111,6 +504,6 @@ void TSPProblem::print_costs() {
 *
 *   @return vector of nodes
 */
-vector<Node> TSPProblem::get_nodes() {
+const vector<Node>& TSPProblem::get_nodes() const {
 	return nodes;
 }
@@ -13,48 +13,51 @@
  */
 
 #include "../include/TSPSolution.h"
+#include "../include/TwoOptSearch.h"
+#include "../include/ListTwoOptSearch.h"
+#include "../include/OrOptSearch.h"
 #include "../include/TSPProblem.h"
 #include <fstream>
 #include <iostream>
+#include <algorithm>
+#include <math.h>
 #include <assert.h>
 
 using namespace std;
 
 /**
 *	@brief	Constructor: create a solution for the model.
-*			Method: pseudo-greey
+*			Method: pseudo-greey (random choices drawn from <rng>)
 */
-TSPSolution::TSPSolution(TSPProblem *problem) {
+TSPSolution::TSPSolution(TSPProblem *problem, RandomEngine& rng) {
 	this->problem = problem;
 
 	// Solutions are build with a pseudo-greedy approach:
 	// choose randomly a successor among those avaiable, considering how much they improve "fitness"
-	vector< vector<double> > C = problem->get_costs();
 	unsigned int N = problem->get_size();
 	solution_cost = 0;
 	path.resize(N + 1);
 	path[0] = 0;	// starting node is 0
 
-	vector<Node> nodes(N-1);	// vector of nodes to be choosen
+	vector<Node> nodes(N-1);	// vector of nodes to be choosen (in any order)
 	for (unsigned int i = 0; i < N-1; ++i) {
 		nodes[i] = i+1;
 	}
 
 	for (unsigned int i = 1; i < N; ++i) {
-		Node selected_node = choose_node(path[i-1], nodes, C);
-		solution_cost += C[path[i-1]][selected_node];	// compute the cost of the solution so far
+		unsigned int k = choose_node(path[i-1], nodes, rng);
+		Node selected_node = nodes[k];
+		solution_cost += problem->cost(path[i-1], selected_node);	// compute the cost of the solution so far
 		path[i] = selected_node;
 
-		// re-compute the vector of possible nodes
-		vector<Node> new_nodes;
-		for (unsigned int j = 0; j < nodes.size(); ++j) {
-			if (nodes[j] != selected_node) { new_nodes.push_back(nodes[j]);}
-		}
-		assert(nodes.size() == new_nodes.size()+1);
-		nodes = new_nodes;
+		// remove the selected node: swap it with the last one
+		nodes[k] = nodes.back();
+		nodes.pop_back();
 	}
-	solution_cost += C[path[N-1]][0];	// cost of the second-to-last node
+	solution_cost += problem->cost(path[N-1], 0);	// cost of the second-to-last node
 	path[N] = 0;	// ending node should be always 0
+	this->hash = TourHash::of(&path[0], N, problem->is_symmetric());
+	this->indexed = false;
 }
 
 /**
@@ -65,8 +68,6 @@ TSPSolution::TSPSolution(TSPProblem *problem, vector<Node> p) {
 	this->problem = problem;
 	unsigned int N = problem->get_size();
 
-	vector< vector<double> > C = problem->get_costs();
-
 	// create and then "copy" the given path
 	this->path.resize(p.size());
 	for (unsigned int j = 0; j < path.size(); ++j) { path[j] = p[j]; }
@@ -77,10 +78,192 @@ TSPSolution::TSPSolution(TSPProblem *problem, vector<Node> p) {
 	for (unsigned int i = 0; i < N; ++i) {
 		debug_sum += path[i];
 		debug_sum_2 += i;
-		this->solution_cost += C[path[i]][path[i+1]];
+		this->solution_cost += problem->cost(path[i], path[i+1]);
 	}
 
 	assert(debug_sum == debug_sum_2);	// note: told to do so but not sure why
+	this->hash = TourHash::of(&path[0], N, problem->is_symmetric());
+	this->indexed = false;
+}
+
+/**
+*	@brief	Constructor: create a solution of the model from a given
+*			solution path whose cost is already known (delta evaluation).
+*
+*	@section DESCRIPTION
+*	The cost is trusted, the path is not summed again.
+*	Build with -DDELTA_CHECK (make DELTA_CHECK=1) to cross-check it
+*	against a full evaluation.
+*/
+TSPSolution::TSPSolution(TSPProblem *problem, vector<Node> p, double cost) {
+	this->problem = problem;
+	this->path.swap(p);
+	this->solution_cost = cost;
+	this->hash = TourHash::of(&this->path[0], problem->get_size(), problem->is_symmetric());
+	this->indexed = false;
+
+#ifdef DELTA_CHECK
+	double full_cost = path_cost(problem, &path[0], 0, problem->get_size());
+	assert(fabs(full_cost - cost) <= 1e-6 * std::max(1.0, full_cost));
+#endif
+}
+
+/**
+*	@brief	Cost of the edges of <path> between positions <from> and <to>,
+*			i.e. path[from] -> path[from+1] -> ... -> path[to]
+*
+*	@return the cost of the sub-path
+*/
+double TSPSolution::path_cost(TSPProblem* problem, const Node* path, \
+							unsigned int from, unsigned int to) {
+	double cost = 0;
+	for (unsigned int i = from; i < to; ++i) {
+		cost += problem->cost(path[i], path[i+1]);
+	}
+	return cost;
+}
+
+/**
+*	@brief	Cost of the edges of this solution between positions <from> and <to>
+*
+*	@return the cost of the sub-path
+*/
+double TSPSolution::segment_cost(unsigned int from, unsigned int to) const {
+	return path_cost(this->problem, &this->path[0], from, to);
+}
+
+/**
+*	@brief	Change of the cost if the sub-path between positions <z> and <t>
+*			(1 <= z < t < N) was reversed (inversion mutation, 2-opt move).
+*
+*	@section DESCRIPTION
+*	With a symmetric problem only the two edges at the borders change,
+*	otherwise the inner edges are traversed the other way round too.
+*
+*	@return new cost - current cost
+*/
+double TSPSolution::reversal_delta(unsigned int z, unsigned int t) const {
+	return reversal_delta(this->problem, &this->path[0], z, t);
+}
+
+/**
+*	@brief	Same as above, for the tour stored in <path>
+*
+*	@return new cost - current cost
+*/
+double TSPSolution::reversal_delta(TSPProblem* problem, const Node* path, \
+								unsigned int z, unsigned int t) {
+	Node a = path[z-1];
+	Node b = path[t+1];
+
+	double delta = problem->cost(a, path[t]) + problem->cost(path[z], b) \
+				- problem->cost(a, path[z]) - problem->cost(path[t], b);
+
+	if (!problem->is_symmetric()) {
+		for (unsigned int i = z; i < t; ++i) {
+			delta += problem->cost(path[i+1], path[i]) - problem->cost(path[i], path[i+1]);
+		}
+	}
+
+	return delta;
+}
+
+/**
+*	@brief	Improve the solution with local search: 2-opt (symmetric
+*			problems only) and Or-opt moves among the <neighbors> nearest
+*			neighbors of each node, until none of them improves it.
+*			Builds the neighbor lists of the problem if needed
+*			(see TSPProblem::build_neighbors()).
+*
+*	@return the new cost of the solution
+*/
+double TSPSolution::improve(unsigned int neighbors) {
+	this->problem->build_neighbors(neighbors);
+	unsigned int N = this->problem->get_size();
+
+	TwoOptSearch two_opt;
+	ListTwoOptSearch list_two_opt;	// O(sqrt(N)) moves on large tours
+	OrOptSearch or_opt;
+	double delta;
+	do {
+		delta = 0;
+		if (this->problem->is_symmetric() && (N >= LARGE_TOUR)) {
+			list_two_opt.load(this->problem, &this->path[0]);
+			list_two_opt.activate_positions(0, N - 1);
+			delta += list_two_opt.optimize();
+			list_two_opt.store();
+			this->hash ^= list_two_opt.get_hash_delta();
+		} else if (this->problem->is_symmetric()) {
+			two_opt.load(this->problem, &this->path[0]);
+			two_opt.activate_positions(0, N - 1);
+			delta += two_opt.optimize();
+			this->hash ^= two_opt.get_hash_delta();
+		}
+		or_opt.load(this->problem, &this->path[0]);
+		or_opt.activate_positions(0, N - 1);
+		delta += or_opt.optimize();
+		this->hash ^= or_opt.get_hash_delta();
+
+		solution_cost += delta;
+	} while (delta < 0);
+	this->indexed = false;	// the moves do not keep the index
+
+#ifdef DELTA_CHECK
+	assert(fabs(solution_cost - path_cost(this->problem, &this->path[0], 0, N)) \
+			<= 1e-6 * max(1.0, fabs(solution_cost)));
+	assert(this->hash == TourHash::of(&this->path[0], N, this->problem->is_symmetric()));
+#endif
+	return solution_cost;
+}
+
+/**
+*	@brief	Reverse the sub-path between positions <z> and <t>
+*			(1 <= z < t < N): inversion mutation, 2-opt move.
+*			Cost, hash and tour index are updated in O(t - z).
+*
+*	@return void
+*/
+void TSPSolution::reverse(unsigned int z, unsigned int t) {
+	this->solution_cost += reversal_delta(z, t);
+	this->hash ^= TourHash::reversal_delta(&this->path[0], z, t, this->problem->is_symmetric());
+
+	std::reverse(this->path.begin() + z, this->path.begin() + t + 1);
+	if (this->indexed) { index_path(z - 1, t + 1); }
+
+#ifdef DELTA_CHECK
+	unsigned int N = this->problem->get_size();
+	assert(fabs(solution_cost - path_cost(this->problem, &this->path[0], 0, N)) \
+			<= 1e-6 * max(1.0, fabs(solution_cost)));
+	assert(this->hash == TourHash::of(&this->path[0], N, this->problem->is_symmetric()));
+#endif
+}
+
+/**
+*	@brief	Refresh the tour index of the nodes in positions [from, to]
+*			(0 <= from <= to <= N): their position, and the links
+*			between consecutive nodes. The first call builds it all.
+*
+*	@return void
+*/
+void TSPSolution::index_path(unsigned int from, unsigned int to) const {
+	unsigned int N = this->problem->get_size();
+	if (!this->indexed) {
+		this->position.resize(N);
+		this->successor.resize(N);
+		this->predecessor.resize(N);
+		from = 0;
+		to = N;
+		this->indexed = true;
+	}
+
+	for (unsigned int i = from; i <= to; i++) {
+		Node n = this->path[i];
+		if (i < N) {	// node 0 is at both ends: position 0
+			this->position[n] = i;
+			this->successor[n] = this->path[i + 1];
+		}
+		if (i > 0) { this->predecessor[n] = this->path[i - 1]; }
+	}
 }
 
 /**
@@ -97,7 +280,7 @@ double TSPSolution::get_solution_cost() {
 *
 *   @return return the path value
 */
-vector<Node> TSPSolution::get_path() {
+const vector<Node>& TSPSolution::get_path() const {
 	return this->path;
 }
 
@@ -115,23 +298,35 @@ void TSPSolution::print_path() {
 }
 
 /**
-*   @brief	return the next node in the path
+*   @brief	Whether <b> is met going from <a> to <c> along the tour
+*			(successor direction), <a> and <c> included
 *
-*   @return return a node
+*   @return true if b is between a and c
 */
-Node TSPSolution::next_node(Node from) {
-	for (unsigned int i = 0; i < this->path.size()-1; ++i) {
-		if (this->path[i] == from){
-			return this->path[i+1];
-		}
+bool TSPSolution::between(Node a, Node b, Node c) const {
+	check_index();
+	unsigned int pa = this->position[a];
+	unsigned int pb = this->position[b];
+	unsigned int pc = this->position[c];
+	if (pa <= pc) {
+		return (pa <= pb) && (pb <= pc);
 	}
-
-	assert(false);	// shouldn't be here --> error
-	return -1;
+	return (pb >= pa) || (pb <= pc);	// the way from a to c goes through node 0
 }
 
+/**
+*   @brief	Compare with another solution: the same tour, in either
+*			direction on symmetric problems. Hashes are compared first
+*			(see TourHash).
+*
+*   @return true if they have the same edges
+*/
 bool TSPSolution::equals(TSPSolution &sol) {
-	return this->path == sol.path;
+	if ((this->hash != sol.hash) || (this->path.size() != sol.path.size())) {
+		return false;
+	}
+	if (this->path == sol.path) { return true; }
+	return this->problem->is_symmetric() && std::equal(this->path.begin(), this->path.end(), sol.path.rbegin());
 }
 
 
@@ -139,38 +334,59 @@ bool TSPSolution::equals(TSPSolution &sol) {
 *   @brief	choose (weighted) wich node should be used
 *	as destination node starting from node "from".
 *
-*   @return return a node
+*	@section DESCRIPTION
+*	Each candidate j gets a weight tot - C_from,j (less cost --> more
+*	probability), where tot is the sum of the costs to all the candidates.
+*	Since tot - C_from,j is the sum of the costs of the *other* candidates,
+*	the same roulette is obtained by:
+*	- picking a candidate k with probability C_from,k / tot,
+*	- then picking j uniformly among the candidates other than k.
+*	The first step is a rejection sampling against max_cost_from(from),
+*	so no total has to be computed: O(1) expected per node instead of O(N).
+*	If too many proposals are rejected the roulette over the totals is used.
+*
+*   @return return the index of the chosen node in "nodes"
 */
-Node TSPSolution::choose_node(Node from, vector<Node> nodes, vector< vector<double> >& C){
-	if (nodes.size() == 1){
-		return nodes[0];
+unsigned int TSPSolution::choose_node(Node from, const vector<Node>& nodes, RandomEngine& rng){
+	unsigned int m = nodes.size();
+	if (m == 1){
+		return 0;
 	}
 
-	double tot = 0;
-	for (unsigned int i = 0; i < nodes.size(); ++i) {
-		tot += C[from][nodes[i]];
+	// Step 1: k with probability C_from,k / tot
+	unsigned int k = m;
+	double bound = problem->max_cost_from(from);
+	for (unsigned int trial = 0; (trial < MAX_REJECTIONS) && (bound > 0); ++trial) {
+		unsigned int r = rng.uniform_int(m);
+		if (rng.uniform_double() * bound < problem->cost(from, nodes[r])) {
+			k = r;
+			break;
+		}
 	}
-	vector<double> adjusted_costs;	// less cost --> more probability
 
-	double adjusted_tot = 0;
-	for (unsigned int i = 0; i < nodes.size(); ++i) {
-		double adjusted_cost = tot - C[from][nodes[i]];
-		adjusted_costs.push_back(adjusted_cost);
-		adjusted_tot += adjusted_cost;
-	}
+	if (k == m) {
+		// too many rejections: sum over all probability until they becom
+		// bigger than the value we got
+		double tot = 0;
+		for (unsigned int i = 0; i < m; ++i) {
+			tot += problem->cost(from, nodes[i]);
+		}
+		if (tot == 0) {
+			return rng.uniform_int(m);	// all the candidates are equivalent
+		}
 
-	double val = (rand() / (double) RAND_MAX) * adjusted_tot;	// random number in [0, tot]
-	assert(val >= 0);
-	assert(val <= adjusted_tot);
-
-	// sum over all probability until they becom bigger than the value we got
-	// when that appens: the index which cause that is the one randomly chosen
-	unsigned int i = 0;
-	double sum = 0;
-	while (val > sum){
-		sum += adjusted_costs[i];
-		if (val > sum) {i++;} // skip the last one
+		double val = rng.uniform_double() * tot;	// random number in [0, tot)
+		double sum = 0;
+		for (k = 0; k < m-1; ++k) {
+			sum += problem->cost(from, nodes[k]);
+			if (val < sum) { break; }
+		}
 	}
-	assert(i < nodes.size());
-	return nodes[i];
+
+	// Step 2: j uniformly among the others
+	unsigned int j = rng.uniform_int(m-1);
+	if (j >= k) { j++; }
+
+	assert(j < m);
+	return j;
 }
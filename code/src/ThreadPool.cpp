@@ -0,0 +1,169 @@
+/**
+ *  @file    ThreadPool.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Thread pool class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  A fixed set of worker threads running parallel loops.
+ *	The tasks of a loop are split among the workers' queues;
+ *	a worker that empties its own queue steals from the others.
+ *	The calling thread takes part in the loop as worker 0.
+ *
+ */
+
+#include "../include/ThreadPool.h"
+
+using namespace std;
+
+/**
+*	@brief	Default contructor: start <workers>-1 threads
+*			(the caller is the first worker)
+*/
+ThreadPool::ThreadPool(unsigned int workers) {
+	this->workers = (workers > 0) ? workers : 1;
+	this->epoch = 0;
+	this->busy = 0;
+	this->stopping = false;
+
+	for (unsigned int w = 0; w < this->workers; w++) {
+		this->queues.push_back(new WorkQueue());
+	}
+	for (unsigned int w = 1; w < this->workers; w++) {
+		this->threads.push_back(std::thread(&ThreadPool::worker_loop, this, w));
+	}
+}
+
+/**
+*	@brief	Destructor: stop and join the threads
+*/
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> guard(this->state_lock);
+		this->stopping = true;
+	}
+	this->wake.notify_all();
+
+	for (auto & t : this->threads) { t.join(); }
+	for (auto & q : this->queues) { delete q; }
+}
+
+/**
+*	@brief	Number of workers (caller included)
+*
+*	@return number of workers
+*/
+unsigned int ThreadPool::size() const {
+	return this->workers;
+}
+
+/**
+*	@brief	Run body(task, worker) for each task in [0, tasks) and wait
+*			for all of them. <worker> identifies the thread running the
+*			task (0 <= worker < size()), to index per-thread data.
+*
+*	@return void
+*/
+void ThreadPool::parallel_for(unsigned int tasks, \
+						std::function<void(unsigned int task, unsigned int worker)> body) {
+	if (this->workers == 1) {
+		for (unsigned int t = 0; t < tasks; t++) { body(t, 0); }
+		return;
+	}
+
+	// contiguous blocks of tasks to each worker
+	for (unsigned int w = 0; w < this->workers; w++) {
+		unsigned int from = (unsigned long) tasks * w / this->workers;
+		unsigned int to = (unsigned long) tasks * (w + 1) / this->workers;
+
+		std::lock_guard<std::mutex> guard(this->queues[w]->lock);
+		for (unsigned int t = from; t < to; t++) {
+			this->queues[w]->tasks.push_back(t);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(this->state_lock);
+		this->body = body;
+		this->busy = this->workers - 1;
+		this->epoch++;
+	}
+	this->wake.notify_all();
+
+	run_tasks(0);
+
+	std::unique_lock<std::mutex> guard(this->state_lock);
+	this->done.wait(guard, [this]() { return this->busy == 0; });
+	this->body = nullptr;
+}
+
+/**
+*	@brief	Threads main loop: wait for a parallel loop and run its tasks
+*
+*	@return void
+*/
+void ThreadPool::worker_loop(unsigned int worker) {
+	unsigned long seen = 0;
+
+	while (1) {
+		{
+			std::unique_lock<std::mutex> guard(this->state_lock);
+			this->wake.wait(guard, [this, seen]() { return this->stopping || (this->epoch != seen); });
+			if (this->stopping) { return; }
+			seen = this->epoch;
+		}
+
+		run_tasks(worker);
+
+		{
+			std::lock_guard<std::mutex> guard(this->state_lock);
+			this->busy--;
+			if (this->busy == 0) { this->done.notify_one(); }
+		}
+	}
+}
+
+/**
+*	@brief	Run tasks until there are none left in any queue
+*
+*	@return void
+*/
+void ThreadPool::run_tasks(unsigned int worker) {
+	unsigned int task;
+	while (next_task(worker, task)) {
+		this->body(task, worker);
+	}
+}
+
+/**
+*	@brief	Take a task: the last one of the own queue, otherwise
+*			the first one of another worker's queue (stealing).
+*
+*	@return false if all the queues are empty
+*/
+bool ThreadPool::next_task(unsigned int worker, unsigned int& task) {
+	{
+		WorkQueue* own = this->queues[worker];
+		std::lock_guard<std::mutex> guard(own->lock);
+		if (!own->tasks.empty()) {
+			task = own->tasks.back();
+			own->tasks.pop_back();
+			return true;
+		}
+	}
+
+	for (unsigned int k = 1; k < this->workers; k++) {
+		WorkQueue* victim = this->queues[(worker + k) % this->workers];
+		std::lock_guard<std::mutex> guard(victim->lock);
+		if (!victim->tasks.empty()) {
+			task = victim->tasks.front();
+			victim->tasks.pop_front();
+			return true;
+		}
+	}
+
+	return false;
+}
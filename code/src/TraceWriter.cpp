@@ -0,0 +1,141 @@
+/**
+ *  @file    TraceWriter.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Convergence trace writer class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  Double-buffered writer of the GA convergence trace
+ *	(see TraceWriter.h).
+ *
+ */
+
+#include <cstring>
+#include <stdexcept>
+#include <stdint.h>
+#include "../include/TraceWriter.h"
+
+using namespace std;
+
+/**
+*	@brief	Append the bytes of <value> to <buffer>
+*			(the machine is assumed to be little endian)
+*/
+template <class T>
+static inline void put(vector<char>& buffer, T value) {
+	char bytes[sizeof(T)];
+	std::memcpy(bytes, &value, sizeof(T));
+	buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+/**
+*	@brief	Constructor: create <filename>, write the header and
+*			start the background thread
+*/
+TraceWriter::TraceWriter(const string& filename, unsigned int problem_size, unsigned int population_size) {
+	this->output.open(filename, ios::out | ios::binary | ios::trunc);
+	if (!this->output.is_open()) {
+		throw std::runtime_error("TraceWriter: cannot open " + filename);
+	}
+
+	vector<char> header(std::begin("GATRACE"), std::end("GATRACE"));	// 8 bytes, with the '\0'
+	put<uint32_t>(header, VERSION);
+	put<uint32_t>(header, problem_size);
+	put<uint32_t>(header, population_size);
+	put<uint32_t>(header, RECORD_SIZE);
+	this->output.write(&header[0], header.size());
+
+	this->front.reserve(BUFFER_RECORDS * RECORD_SIZE);
+	this->back.reserve(BUFFER_RECORDS * RECORD_SIZE);
+	this->back_full = false;
+	this->stopping = false;
+	this->writer = std::thread(&TraceWriter::writer_loop, this);
+}
+
+/**
+*	@brief	Destructor: write what is left
+*/
+TraceWriter::~TraceWriter() {
+	close();
+}
+
+/**
+*	@brief	Add a record (written later, by the background thread)
+*
+*	@return void
+*/
+void TraceWriter::write(const Record& record) {
+	put<uint32_t>(this->front, record.generation);
+	put<double>(this->front, record.elapsed);
+	put<double>(this->front, record.best);
+	put<double>(this->front, record.worst);
+	put<double>(this->front, record.mean);
+	put<double>(this->front, record.diversity);
+
+	if (this->front.size() >= BUFFER_RECORDS * RECORD_SIZE) {
+		flush_front();
+	}
+}
+
+/**
+*	@brief	Hand the front buffer to the background thread, waiting
+*			for it to be done with the previous one
+*
+*	@return void
+*/
+void TraceWriter::flush_front() {
+	{
+		std::unique_lock<std::mutex> guard(this->state_lock);
+		this->written.wait(guard, [&] { return !this->back_full; });
+		this->front.swap(this->back);
+		this->back_full = true;
+	}
+	this->ready.notify_one();
+}
+
+/**
+*	@brief	Background thread: write the full buffers, until close()
+*
+*	@return void
+*/
+void TraceWriter::writer_loop() {
+	std::unique_lock<std::mutex> guard(this->state_lock);
+	while (true) {
+		this->ready.wait(guard, [&] { return this->back_full || this->stopping; });
+		if (this->back_full) {
+			// the GA does not touch the back buffer while it is full
+			guard.unlock();
+			this->output.write(&this->back[0], this->back.size());
+			this->back.clear();
+			guard.lock();
+			this->back_full = false;
+			this->written.notify_one();
+		} else {
+			return;	// stopping, nothing left
+		}
+	}
+}
+
+/**
+*	@brief	Write the records left, stop the background thread
+*			and close the file (once)
+*
+*	@return void
+*/
+void TraceWriter::close() {
+	if (!this->writer.joinable()) { return; }
+
+	if (!this->front.empty()) {
+		flush_front();
+	}
+	{
+		std::lock_guard<std::mutex> guard(this->state_lock);
+		this->stopping = true;
+	}
+	this->ready.notify_one();
+	this->writer.join();
+	this->output.close();
+}
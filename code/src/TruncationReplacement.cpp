@@ -0,0 +1,43 @@
+/**
+ *  @file    TruncationReplacement.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Truncation replacement class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  Replacement operator of the GA: the new generation is made
+ *	of the best individuals among the old one and the offspring.
+ *
+ */
+
+#include <algorithm>
+#include "../include/TruncationReplacement.h"
+
+using namespace std;
+
+/**
+*	@brief	Keep the <size> best individuals among <population>
+*			and <offspring> (ties broken by slot, so that the result
+*			does not depend on the order of the candidates).
+*			The slots of the others are put in <discarded>.
+*
+*	@return void
+*/
+void TruncationReplacement::replace(vector<Slot>& population, const vector<Slot>& offspring, \
+									const vector<double>& fitness, unsigned int size, \
+									RandomEngine& rng, vector<Slot>& discarded) {
+	this->candidates.assign(population.begin(), population.end());
+	this->candidates.insert(this->candidates.end(), offspring.begin(), offspring.end());
+	size = std::min(size, (unsigned int) this->candidates.size());
+
+	std::nth_element(this->candidates.begin(), this->candidates.begin() + size, this->candidates.end(), \
+					[&fitness](Slot a, Slot b) {
+						return (fitness[a] < fitness[b]) || ((fitness[a] == fitness[b]) && (a < b));
+					});
+
+	population.assign(this->candidates.begin(), this->candidates.begin() + size);
+	discarded.assign(this->candidates.begin() + size, this->candidates.end());
+}
@@ -0,0 +1,353 @@
+/**
+ *  @file    TwoLevelList.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief Two-level doubly-linked list tour class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  A tour as a two-level doubly-linked list (see TwoLevelList.h).
+ *
+ */
+
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "../include/TwoLevelList.h"
+
+using namespace std;
+
+/**
+*	@brief	Default contructor (no tour loaded)
+*/
+TwoLevelList::TwoLevelList() {
+	this->N = 0;
+	this->group_size = 0;
+	this->unbalanced = false;
+}
+
+/**
+*	@brief	Load the tour in <path> (N+1 nodes, node 0 at both ends):
+*			segments of about sqrt(N) consecutive nodes.
+*
+*	@return void
+*/
+void TwoLevelList::load(const Node* path, unsigned int N) {
+	if (N < 4) {
+		throw std::runtime_error("TwoLevelList: at least 4 nodes needed");
+	}
+	this->N = N;
+	this->group_size = std::max(2u, (unsigned int) ceil(sqrt((double) N)));
+	unsigned int S = (N + this->group_size - 1) / this->group_size;
+
+	this->segments.resize(S);
+	this->parent.resize(N);
+	this->id.resize(N);
+	this->link_next.resize(N);
+	this->link_prev.resize(N);
+	this->unbalanced = false;
+
+	for (unsigned int s = 0; s < S; s++) {
+		unsigned int from = s * this->group_size;
+		unsigned int to = std::min(N, from + this->group_size);	// [from, to)
+
+		Segment& segment = this->segments[s];
+		segment.reversed = false;
+		segment.first = path[from];
+		segment.last = path[to - 1];
+		segment.size = to - from;
+		segment.rank = s;
+		segment.next = (s + 1) % S;
+		segment.prev = (s + S - 1) % S;
+
+		for (unsigned int i = from; i < to; i++) {
+			this->parent[path[i]] = s;
+			this->id[path[i]] = i - from;
+		}
+	}
+
+	for (unsigned int i = 0; i < N; i++) {
+		this->link_next[path[i]] = path[i + 1];
+		this->link_prev[path[i + 1]] = path[i];
+	}
+}
+
+/**
+*	@brief	Write the tour in <path> (N+1 nodes, node 0 at both ends)
+*
+*	@return void
+*/
+void TwoLevelList::store(Node* path) const {
+	Node n = 0;
+	for (unsigned int i = 0; i < this->N; i++) {
+		path[i] = n;
+		n = next(n);
+	}
+	path[this->N] = 0;
+}
+
+/**
+*	@brief	Reverse the path from <a> to <b> (along the tour): the
+*			edges (prev(a),a) and (b,next(b)) become (prev(a),b) and
+*			(a,next(b)), as in a 2-opt move.
+*
+*	@section DESCRIPTION
+*	Reversing a..b or the rest of the tour gives the same cycle:
+*	the shorter one is reversed, so the orientation of the tour
+*	may change.
+*	Inside a segment the nodes are relinked one by one. Otherwise
+*	the segments are split so that a..b is made of whole segments
+*	(each split moves at most half a segment to the next one), and
+*	the order of these segments is reversed along with their
+*	reversed bits.
+*
+*	@return void
+*/
+void TwoLevelList::reverse(Node a, Node b) {
+	if ((a == b) || (next(b) == a)) { return; }	// nothing, or the whole tour
+
+	if (this->parent[a] == this->parent[b]) {
+		if (offset(a) <= offset(b)) {
+			reverse_inside(a, b);
+		} else {
+			reverse_inside(next(b), prev(a));	// the rest of the tour is in the segment
+		}
+		return;
+	}
+
+	split_before(a);
+	if (this->parent[a] != this->parent[b]) {
+		split_after(b, this->parent[a]);
+	}
+
+	if (this->parent[a] == this->parent[b]) {
+		reverse_inside(a, b);	// a split joined a and b in one segment, a first
+	} else {
+		unsigned int S = this->segments.size();
+		unsigned int first = this->parent[a];
+		unsigned int last = this->parent[b];
+		unsigned int count = (this->segments[last].rank + S - this->segments[first].rank) % S + 1;
+		if (2 * count <= S) {
+			reverse_segments(first, last, count);
+		} else {
+			reverse_segments(this->segments[last].next, this->segments[first].prev, S - count);
+		}
+	}
+
+	if (this->unbalanced) { rebuild(); }
+}
+
+/**
+*	@brief	Reverse the path a..b, inside one segment
+*
+*	@return void
+*/
+void TwoLevelList::reverse_inside(Node a, Node b) {
+	Segment& segment = this->segments[this->parent[a]];
+	Node before_a = prev(a);
+	Node after_b = next(b);
+
+	this->moved.clear();
+	this->moved_ids.clear();
+	for (Node n = a; ; n = next(n)) {
+		this->moved.push_back(n);
+		this->moved_ids.push_back(this->id[n]);
+		if (n == b) { break; }
+	}
+
+	unsigned int k = this->moved.size();
+	int lo = std::min(this->id[a], this->id[b]);
+	int hi = std::max(this->id[a], this->id[b]);
+	bool first_moved = (this->id[segment.first] == lo);
+	bool last_moved = (this->id[segment.last] == hi);
+
+	// the nodes swap their ids, then get linked in the new order
+	for (unsigned int i = 0; i < k; i++) {
+		this->id[this->moved[i]] = this->moved_ids[k - 1 - i];
+	}
+	Node node_lo = (this->moved_ids[0] == lo) ? b : a;
+	Node node_hi = (node_lo == a) ? b : a;
+	if (first_moved) { segment.first = node_lo; }
+	if (last_moved) { segment.last = node_hi; }
+
+	set_link(before_a, b);
+	for (unsigned int i = k - 1; i > 0; i--) {
+		set_link(this->moved[i], this->moved[i - 1]);
+	}
+	set_link(a, after_b);
+}
+
+/**
+*	@brief	Make <a> the first node of its segment (along the tour),
+*			moving the smaller part of the segment to the previous
+*			or to the next one.
+*
+*	@return void
+*/
+void TwoLevelList::split_before(Node a) {
+	unsigned int s = this->parent[a];
+	if (head(s) == a) { return; }
+
+	unsigned int before_a = abs(this->id[a] - this->id[head(s)]);
+	if (2 * before_a <= this->segments[s].size) {
+		move_to_prev(s, prev(a));
+	} else {
+		move_to_next(s, a);
+	}
+}
+
+/**
+*	@brief	Make <b> the last node of its segment (along the tour),
+*			moving the smaller part of the segment to the next or to
+*			the previous one, but never to the head of <keep_head>.
+*
+*	@return void
+*/
+void TwoLevelList::split_after(Node b, unsigned int keep_head) {
+	unsigned int s = this->parent[b];
+	if (tail(s) == b) { return; }
+
+	unsigned int after_b = abs(this->id[tail(s)] - this->id[b]);
+	if ((2 * after_b <= this->segments[s].size) && (this->segments[s].next != keep_head)) {
+		move_to_next(s, next(b));
+	} else {
+		move_to_prev(s, b);
+	}
+}
+
+/**
+*	@brief	Move the nodes of segment <s> from its head to <to>
+*			(along the tour) at the end of the previous segment
+*
+*	@return void
+*/
+void TwoLevelList::move_to_prev(unsigned int s, Node to) {
+	unsigned int p = this->segments[s].prev;
+	Node before = tail(p);
+	Node after = next(to);
+
+	this->moved.clear();
+	for (Node n = head(s); ; n = next(n)) {
+		this->moved.push_back(n);
+		if (n == to) { break; }
+	}
+	unsigned int m = this->moved.size();
+
+	// what is left of s starts from <after>
+	if (this->segments[s].reversed) { this->segments[s].last = after; } else { this->segments[s].first = after; }
+	this->segments[s].size -= m;
+
+	int step = this->segments[p].reversed ? -1 : 1;
+	int base = this->id[before];
+	for (unsigned int i = 0; i < m; i++) {
+		this->parent[this->moved[i]] = p;
+		this->id[this->moved[i]] = base + step * (int) (i + 1);
+	}
+	if (this->segments[p].reversed) { this->segments[p].first = this->moved[m - 1]; } else { this->segments[p].last = this->moved[m - 1]; }
+	this->segments[p].size += m;
+
+	set_link(before, this->moved[0]);
+	for (unsigned int i = 1; i < m; i++) {
+		set_link(this->moved[i - 1], this->moved[i]);
+	}
+	set_link(this->moved[m - 1], after);
+
+	if ((this->segments[p].size > MAX_GROWTH * this->group_size) || (abs(base) + (int) m >= MAX_ID)) {
+		this->unbalanced = true;
+	}
+}
+
+/**
+*	@brief	Move the nodes of segment <s> from <from> to its tail
+*			(along the tour) at the start of the next segment
+*
+*	@return void
+*/
+void TwoLevelList::move_to_next(unsigned int s, Node from) {
+	unsigned int q = this->segments[s].next;
+	Node before = prev(from);
+	Node after = head(q);
+
+	this->moved.clear();
+	for (Node n = from; ; n = next(n)) {
+		this->moved.push_back(n);
+		if (n == tail(s)) { break; }
+	}
+	unsigned int m = this->moved.size();
+
+	// what is left of s ends with <before>
+	if (this->segments[s].reversed) { this->segments[s].first = before; } else { this->segments[s].last = before; }
+	this->segments[s].size -= m;
+
+	int step = this->segments[q].reversed ? 1 : -1;
+	int base = this->id[after];
+	for (unsigned int i = 0; i < m; i++) {
+		this->parent[this->moved[i]] = q;
+		this->id[this->moved[i]] = base + step * (int) (m - i);
+	}
+	if (this->segments[q].reversed) { this->segments[q].last = this->moved[0]; } else { this->segments[q].first = this->moved[0]; }
+	this->segments[q].size += m;
+
+	set_link(before, this->moved[0]);
+	for (unsigned int i = 1; i < m; i++) {
+		set_link(this->moved[i - 1], this->moved[i]);
+	}
+	set_link(this->moved[m - 1], after);
+
+	if ((this->segments[q].size > MAX_GROWTH * this->group_size) || (abs(base) + (int) m >= MAX_ID)) {
+		this->unbalanced = true;
+	}
+}
+
+/**
+*	@brief	Reverse the <count> segments from <first> to <last>
+*			(along the tour): their order, and their reversed bits.
+*
+*	@return void
+*/
+void TwoLevelList::reverse_segments(unsigned int first, unsigned int last, unsigned int count) {
+	unsigned int S = this->segments.size();
+	unsigned int before = this->segments[first].prev;
+	unsigned int after = this->segments[last].next;
+	unsigned int rank = this->segments[first].rank;
+
+	this->run.clear();
+	for (unsigned int s = first; ; s = this->segments[s].next) {
+		this->run.push_back(s);
+		if (s == last) { break; }
+	}
+	assert(this->run.size() == count);
+
+	// new order: before, run[count-1], ..., run[0], after
+	for (unsigned int i = 0; i < count; i++) {
+		Segment& segment = this->segments[this->run[count - 1 - i]];
+		segment.reversed = !segment.reversed;
+		segment.rank = (rank + i) % S;
+		segment.prev = (i == 0) ? before : this->run[count - i];
+		segment.next = (i == count - 1) ? after : this->run[count - 2 - i];
+	}
+	this->segments[before].next = this->run[count - 1];
+	this->segments[after].prev = this->run[0];
+
+	// the links inside the segments hold, the ones between them change
+	set_link(tail(before), head(this->run[count - 1]));
+	for (unsigned int i = count - 1; i > 0; i--) {
+		set_link(tail(this->run[i]), head(this->run[i - 1]));
+	}
+	set_link(tail(this->run[0]), head(after));
+}
+
+/**
+*	@brief	Load the tour again, to get segments of the same size
+*			(and small ids) after many splits.
+*
+*	@return void
+*/
+void TwoLevelList::rebuild() {
+	this->order.resize(this->N + 1);
+	store(&this->order[0]);
+	load(&this->order[0], this->N);
+}
@@ -0,0 +1,83 @@
+/**
+ *  @file    TwoOptSearch.cpp
+ *  @author  Marco Romanelli
+ *  @date    17/10/2026
+ *  @version 1.0
+ *
+ *  @brief 2-opt local search class file
+ *
+ *  @section DESCRIPTION
+ *
+ *  A 2-opt local search working in place on a tour buffer
+ *	(see LocalSearch).
+ *
+ */
+
+#include <algorithm>
+#include "../include/TwoOptSearch.h"
+
+using namespace std;
+
+/**
+*	@brief	Look for an improving move removing one of the two edges
+*			of node <a>, and apply the first one found.
+*
+*	@section DESCRIPTION
+*	Edge (a,b) is replaced by (a,c), c a neighbor of a, and the edge
+*	(c,d) on the same side of c by (b,d). Neighbors are sorted by cost,
+*	so the scan stops as soon as C_a,c >= C_a,b: no gain is possible.
+*	Edges are numbered by the position of their first node, and the
+*	move reverses the path between the two removed edges.
+*
+*	@return true if the tour changed (<delta> is updated)
+*/
+bool TwoOptSearch::improve_node(Node a, double& delta) {
+	const Node* first = this->problem->get_neighbors().begin(a);
+	const Node* last = this->problem->get_neighbors().end(a);
+
+	for (int side = 0; side < 2; side++) {
+		// edge (a,b): b follows a (side 0) or precedes it (side 1)
+		unsigned int edge_a = (side == 0) ? edge_after(a) : edge_before(a);
+		Node b = (side == 0) ? this->path[edge_a + 1] : this->path[edge_a];
+		double d_ab = this->problem->cost(a, b);
+
+		for (const Node* it = first; it != last; ++it) {
+			Node c = *it;
+			double g1 = d_ab - this->problem->cost(a, c);
+			if (g1 <= EPSILON) { break; }
+
+			unsigned int edge_c = (side == 0) ? edge_after(c) : edge_before(c);
+			Node d = (side == 0) ? this->path[edge_c + 1] : this->path[edge_c];
+			if ((c == b) || (d == a)) { continue; }	// adjacent edges
+
+			double gain = g1 + this->problem->cost(c, d) - this->problem->cost(b, d);
+			if (gain > EPSILON) {
+				apply_move(std::min(edge_a, edge_c), std::max(edge_a, edge_c));
+				delta -= gain;
+
+				activate(a);
+				activate(b);
+				activate(c);
+				activate(d);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+*	@brief	Remove edges <p> and <q> (p < q) reversing the path
+*			in positions [p+1, q]: node 0 never moves.
+*
+*	@return void
+*/
+void TwoOptSearch::apply_move(unsigned int p, unsigned int q) {
+	toggle_edge(this->path[p], this->path[p + 1]);
+	toggle_edge(this->path[q], this->path[q + 1]);
+	toggle_edge(this->path[p], this->path[q]);
+	toggle_edge(this->path[p + 1], this->path[q + 1]);
+
+	std::reverse(this->path + p + 1, this->path + q + 1);
+	update_positions(p + 1, q);
+}
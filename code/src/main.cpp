@@ -15,6 +15,9 @@
 
 #include "../include/CPLEXSolver.h"
 #include "../include/GASolver.h"
+#include "../include/GAIslandSolver.h"
+#include "../include/LKSolver.h"
+#include "../include/BatchScheduler.h"
 #include <iostream>
 #include <string>
 #include <sys/time.h>
@@ -22,36 +25,141 @@
 #include <algorithm>
 #include <sys/stat.h>
 #include <fstream>
+#include <sstream>
+#include <thread>
 #include <vector>
+#include <unistd.h>
+#include <ctime>
 
 using namespace std;
 
+// GA operators (see GAOperators.h)
+enum CrossoverOperator { ORDER_CROSSOVER, EAX_CROSSOVER };
+enum ReplacementOperator { ROULETTE_REPLACEMENT, TRUNCATION_REPLACEMENT };
+
+// Command line options
+struct Options {
+	unsigned int threads;	// -j: threads used by the GA
+	unsigned int islands;	// -i: islands of the GA (1: no island model)
+	MigrationTopology topology;	// -m: migration topology (ring | random)
+	uint64_t seed;	// -s: seed of the GA random engines (default: current time)
+	unsigned int local_search;	// -l: 2-opt budget per child (0: no memetic mode)
+	bool polish;	// -p: improve the final GA tour with 2-opt and Or-opt
+	CrossoverOperator crossover;	// -x: GA crossover operator (order | eax)
+	ReplacementOperator replacement;	// -r: GA replacement operator (roulette | truncation)
+	unsigned int batch_threads;	// -w: threads of a batch run, shared by the instances solved at once
+	unsigned int cplex_jobs;	// -c: CPLEX models solved at once in a batch run (licenses)
+	string trace_prefix;	// -t: GA convergence traces go to <prefix><instance>.gatrace
+};
+
 int getdir (string dir, vector<string> &files);
 bool is_file(const char* path);
 bool is_dir(const char* path);
-int single_test(string filename);
-int run_instances_with_cplex(vector<string> &files);
-int run_instances_with_ga(vector<string> &files);
+int single_test(string filename, const Options& options);
+int run_instances_with_cplex(vector<string> &files, const Options& options);
+int run_instances_with_ga(vector<string> &files, const Options& options);
+int run_instances_with_lk(vector<string> &files, const Options& options);
+int convert_instances(string input);
+GAIndividual* run_ga(TSPProblem* tspProblem, unsigned int pop_size_factor, \
+					unsigned int time_limit, unsigned int iteration_limit, \
+					double mutation_probability, bool verbose, const Options& options, \
+					const string& trace_file = "");
+template <class Operators>
+GAIndividual* run_ga_with(TSPProblem* tspProblem, unsigned int pop_size_factor, \
+						unsigned int time_limit, unsigned int iteration_limit, \
+						double mutation_probability, bool verbose, const Options& options, \
+						const string& trace_file);
+string trace_filename(const Options& options, const string& instance);
 long long current_timestamp();
 
  /**
  *	@brief	Main function
  *
+ *	@section DESCRIPTION
+ *	Usage:
+ *		main [GA options] <instance>
+ *		main [GA options] <directory> <1: CPLEX | 2: GA | 3: LK>
+ *		main -b <instance | directory>	(convert to binary instances)
+ *	Batch options (<directory>):
+ *		-w <threads>	threads shared by the instances solved at once
+ *					(default: all the cores)
+ *		-c <jobs>	CPLEX models solved at once (default: 1)
+ *	GA options:
+ *		-j <threads>	threads producing the offspring
+ *		-i <islands>	island model with <islands> populations (one thread each)
+ *		-m <ring | random>	islands migration topology
+ *		-s <seed>	seed of the random engines (same seed: same run)
+ *		-l <budget>	memetic mode: 2-opt on each child, examining <budget> nodes
+ *		-p	improve the final tour with 2-opt and Or-opt
+ *		-x <order | eax>	crossover operator
+ *		-r <roulette | truncation>	replacement operator
+ *		-t <prefix>	convergence trace of each GA run, in <prefix><instance>.gatrace
  */
  int main(int argc, char* argv[]) {
-	 if (argc < 2) { return -1; }
+	 Options options;
+	 options.threads = 1;
+	 options.islands = 1;
+	 options.topology = RING;
+	 options.seed = time(NULL);
+	 options.local_search = 0;
+	 options.polish = false;
+	 options.crossover = ORDER_CROSSOVER;
+	 options.replacement = ROULETTE_REPLACEMENT;
+	 options.batch_threads = std::max(1u, std::thread::hardware_concurrency());
+	 options.cplex_jobs = 1;
+	 bool convert = false;
+
+	 int opt;
+	 while ((opt = getopt(argc, argv, "bj:i:m:s:l:px:r:w:c:t:")) != -1) {
+		 switch (opt) {
+			 case 'b': convert = true; break;
+			 case 'j': options.threads = std::max(1, atoi(optarg)); break;
+			 case 'i': options.islands = std::max(1, atoi(optarg)); break;
+			 case 'm':
+				 if (string(optarg) == "random") { options.topology = RANDOM; }
+				 else if (string(optarg) == "ring") { options.topology = RING; }
+				 else { return -1; }
+				 break;
+			 case 's': options.seed = strtoull(optarg, NULL, 10); break;
+			 case 'l': options.local_search = std::max(0, atoi(optarg)); break;
+			 case 'p': options.polish = true; break;
+			 case 'x':
+				 if (string(optarg) == "eax") { options.crossover = EAX_CROSSOVER; }
+				 else if (string(optarg) == "order") { options.crossover = ORDER_CROSSOVER; }
+				 else { return -1; }
+				 break;
+			 case 'r':
+				 if (string(optarg) == "truncation") { options.replacement = TRUNCATION_REPLACEMENT; }
+				 else if (string(optarg) == "roulette") { options.replacement = ROULETTE_REPLACEMENT; }
+				 else { return -1; }
+				 break;
+			 case 'w': options.batch_threads = std::max(1, atoi(optarg)); break;
+			 case 'c': options.cplex_jobs = std::max(1, atoi(optarg)); break;
+			 case 't': options.trace_prefix = optarg; break;
+			 default: return -1;
+		 }
+	 }
+
+	 if (optind >= argc) { return -1; }
 
-	 std::string input = argv[1];
+	 std::string input = argv[optind];
 	 vector<std::string> files = vector<std::string>();
 
+	 // Convert text instances into binary ones
+	 if (convert) {
+		 if (argc - optind != 1) { return -1; }
+		 return convert_instances(input);
+	 }
+
 	 if (is_dir(input.c_str())) {
-		 if (argc != 3) { return -1; }
-		 unsigned int type = atoi(argv[2]);
+		 if (argc - optind != 2) { return -1; }
+		 unsigned int type = atoi(argv[optind + 1]);
 
 		 // Read instances filenames
 		 getdir(input, files);
 
 		 // Some cleaning: filter only .tsp files
+		 // (or their binary version .tspb, when it has been created)
 		 vector<std::string> instances;
 		 for (auto & el : files) {
 			 std::string ext;
@@ -60,7 +168,8 @@ long long current_timestamp();
 			 } catch(std::exception& e) { continue; }
 
 			 if (ext == ".tsp") {
-				 instances.push_back( input + "/" + el );
+				 std::string binary = input + "/" + el + "b";
+				 instances.push_back( is_file(binary.c_str()) ? binary : input + "/" + el );
 			 }
 		 }
 
@@ -69,12 +178,14 @@ long long current_timestamp();
 
 		 // Go!
 		 if (type == 1)
-		 	return run_instances_with_cplex(instances);
+		 	return run_instances_with_cplex(instances, options);
+		else if (type == 3)
+			return run_instances_with_lk(instances, options);
 		else
-			return run_instances_with_ga(instances);
+			return run_instances_with_ga(instances, options);
 	 } else if (is_file(input.c_str())) {
 		 // GO!
-		 return  single_test(input);
+		 return  single_test(input, options);
 	 } else {
 		 cout << "Error." << endl;
 		 return -2;
@@ -88,8 +199,7 @@ long long current_timestamp();
 *
 *	@return exit status (int)
 */
-int run_instances_with_cplex(vector<string> &files) {
-	long long s_time, e_time, cplex_time;
+int run_instances_with_cplex(vector<string> &files, const Options& options) {
 	std::string separator = ",";
 	std::string output_file = "results.csv";
 	ofstream myfile;
@@ -111,20 +221,21 @@ int run_instances_with_cplex(vector<string> &files) {
 		return EXIT_FAILURE;
 	}
 
-	// For each instance:
-	for (unsigned int i = 0; i < files.size(); i++) {
-		std::string instance = files[i];
-		cout << "Now running on: \'" << instance << "\'..." << endl;
-
-		// Create a new problem based on date provided in the file
-		TSPProblem* tspProblem = new TSPProblem(instance);
+	// Instances solved at once: at most <cplex_jobs>, sharing the threads
+	unsigned int job_threads = std::max(1u, options.batch_threads / options.cplex_jobs);
+	BatchScheduler scheduler(options.batch_threads, job_threads, options.cplex_jobs);
+	cout << "Instances solved at once: " << scheduler.get_workers() << \
+		" (" << job_threads << " CPLEX threads each)." << endl;
 
+	BatchScheduler::Job job = [&](const string& instance, TSPProblem* tspProblem) {
 		// Solving problem using CPLEX
+		long long s_time, e_time, cplex_time;
 		TSPSolution* cplexSol = NULL;
 		try {
 			s_time = current_timestamp();
-			CPLEXSolver* cplexSolver = new CPLEXSolver(tspProblem, time_limit);
-			cplexSol = cplexSolver->solve();
+			CPLEXSolver cplexSolver(tspProblem, time_limit);
+			cplexSolver.set_threads(job_threads);
+			cplexSol = cplexSolver.solve();
 			e_time = current_timestamp();
 			cplex_time = e_time - s_time;
 		} catch(std::exception& e) {
@@ -132,16 +243,21 @@ int run_instances_with_cplex(vector<string> &files) {
 			cplex_time = -1;
 		}
 
-		try {
-			// Save cplex results
-			myfile << "\"" << instance << "\"" << separator;
-			myfile << "\"" << tspProblem->get_size() << "\"" << separator;
-			myfile << "\"" << cplex_time << "\"" << separator;
-			myfile << "\"" << ((cplexSol != NULL) ? cplexSol->get_solution_cost() : -1) << "\"" << "\r\n" << std::flush;
-		} catch(std::exception& e) {
-			std::cout << "[!] EXCEPTION: " << e.what() << std::endl;
-			return EXIT_FAILURE;
-		}
+		// Save cplex results
+		ostringstream row;
+		row << "\"" << instance << "\"" << separator;
+		row << "\"" << tspProblem->get_size() << "\"" << separator;
+		row << "\"" << cplex_time << "\"" << separator;
+		row << "\"" << ((cplexSol != NULL) ? cplexSol->get_solution_cost() : -1) << "\"";
+		delete cplexSol;
+		return row.str();
+	};
+
+	try {
+		scheduler.run(files, job, myfile);
+	} catch(std::exception& e) {
+		std::cout << "[!] EXCEPTION: " << e.what() << std::endl;
+		return EXIT_FAILURE;
 	}
 
 	try {
@@ -161,14 +277,14 @@ int run_instances_with_cplex(vector<string> &files) {
 *
 *	@return exit status (int)
 */
-int run_instances_with_ga(vector<string> &files) {
-	long long s_time, e_time, ga_time;
+int run_instances_with_ga(vector<string> &files, const Options& options) {
 	std::string separator = ",";
 	std::string output_file = "results.csv";
 	ofstream myfile;
 
 	cout << "############   TSP SOLVER  ############"<< endl;
 	cout << "Solving instances using GA." << endl;
+	cout << "Seed: " << options.seed << "." << endl;
 
 	// Set up all the parameters
 	unsigned int ga_time_limit = 60 * 5;	// time in seconds
@@ -189,35 +305,39 @@ int run_instances_with_ga(vector<string> &files) {
 		return EXIT_FAILURE;
 	}
 
-	// For each instance:
-	for (unsigned int i = 0; i < files.size(); i++) {
-		std::string instance = files[i];
-		cout << "Now running on: \'" << instance << "\'..." << endl;
-
-		// Create a new problem based on date provided in the file
-		TSPProblem* tspProblem = new TSPProblem(instance);
+	// Every instance uses the threads of a GA run (one per island)
+	unsigned int job_threads = (options.islands > 1) ? options.islands : options.threads;
+	BatchScheduler scheduler(options.batch_threads, job_threads);
+	cout << "Instances solved at once: " << scheduler.get_workers() << "." << endl;
 
+	BatchScheduler::Job job = [&](const string& instance, TSPProblem* tspProblem) {
 		// Solving problem using GA
-		s_time = current_timestamp();
-		GASolver* gaSolver = new GASolver(tspProblem,\
-										ga_population_size_factor,\
-										ga_time_limit,\
-										ga_iteration_limit,\
-										ga_mutation_probability,
-										verbose);
-		GAIndividual* gaSol = gaSolver->solve();
-		e_time = current_timestamp();
-		ga_time = e_time - s_time;
+		tspProblem->set_threads(job_threads);
+		long long s_time = current_timestamp();
+		GAIndividual* gaSol = run_ga(tspProblem,\
+									ga_population_size_factor,\
+									ga_time_limit,\
+									ga_iteration_limit,\
+									ga_mutation_probability,
+									verbose,
+									options,
+									trace_filename(options, instance));
+		long long ga_time = current_timestamp() - s_time;
+
+		ostringstream row;
+		row << "\"" << instance << "\"" << separator;
+		row << "\"" << tspProblem->get_size() << "\"" << separator;
+		row << "\"" << ga_time << "\"" << separator;
+		row << "\"" << gaSol->get_fitness() << "\"";
+		delete gaSol;
+		return row.str();
+	};
 
-		try {
-			myfile << "\"" << instance << "\"" << separator;
-			myfile << "\"" << tspProblem->get_size() << "\"" << separator;
-			myfile << "\"" << ga_time << "\"" << separator;
-			myfile << "\"" << gaSol->get_fitness() << "\"" << "\r\n" << std::flush;
-		} catch(std::exception& e) {
-			std::cout << "[!] EXCEPTION: " << e.what() << std::endl;
-			return EXIT_FAILURE;
-		}
+	try {
+		scheduler.run(files, job, myfile);
+	} catch(std::exception& e) {
+		std::cout << "[!] EXCEPTION: " << e.what() << std::endl;
+		return EXIT_FAILURE;
 	}
 
 	try {
@@ -233,14 +353,83 @@ int run_instances_with_ga(vector<string> &files) {
 }
 
 
+/**
+*	@brief	Runs all the instance and solvs them using LK
+*
+*	@return exit status (int)
+*/
+int run_instances_with_lk(vector<string> &files, const Options& options) {
+	std::string separator = ",";
+	std::string output_file = "results.csv";
+	ofstream myfile;
+
+	cout << "############   TSP SOLVER  ############"<< endl;
+	cout << "Solving instances using LK." << endl;
+	cout << "Seed: " << options.seed << "." << endl;
+
+	// Set up all the parameters
+	unsigned int lk_time_limit = 60 * 5;	// time in seconds
+	unsigned int lk_iteration_limit = 20000;	// maximum number of kicks
+	bool verbose = false;	// To speed up the computation, do not show any messages
+
+	try {
+		myfile.open(output_file, ios::out);
+		myfile << "\"Instance\"" << separator;
+		myfile << "\"Dimension\"" << separator;
+		myfile << "\"LK Time\"" << separator;
+		myfile << "\"LK Sol.\"" << "\r\n" << std::flush;
+	} catch(std::exception& e) {
+		std::cout << "[!] EXCEPTION: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// LK is single threaded
+	BatchScheduler scheduler(options.batch_threads, 1);
+	cout << "Instances solved at once: " << scheduler.get_workers() << "." << endl;
+
+	BatchScheduler::Job job = [&](const string& instance, TSPProblem* tspProblem) {
+		// Solving problem using LK
+		long long s_time = current_timestamp();
+		LKSolver lkSolver(tspProblem, lk_time_limit, lk_iteration_limit, verbose, options.seed);
+		TSPSolution* lkSol = lkSolver.solve();
+		long long lk_time = current_timestamp() - s_time;
+
+		ostringstream row;
+		row << "\"" << instance << "\"" << separator;
+		row << "\"" << tspProblem->get_size() << "\"" << separator;
+		row << "\"" << lk_time << "\"" << separator;
+		row << "\"" << lkSol->get_solution_cost() << "\"";
+		delete lkSol;
+		return row.str();
+	};
+
+	try {
+		scheduler.run(files, job, myfile);
+	} catch(std::exception& e) {
+		std::cout << "[!] EXCEPTION: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	try {
+		myfile.close();
+	} catch(std::exception& e) {
+		std::cout << "[!] EXCEPTION: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	cout << endl << endl;
+
+	return 0;
+}
+
 /**
 *	@brief	Runs a single instance provided in the file.
 *			To use for testing and examples.
 *
 *	@return exit status (int)
 */
-int single_test(string filename) {
-	long long s_time, e_time, cplex_time, ga_time;
+int single_test(string filename, const Options& options) {
+	long long s_time, e_time, cplex_time, ga_time, lk_time;
 
 	cout << "############   TSP SOLVER  ############"<< endl;
 
@@ -249,6 +438,8 @@ int single_test(string filename) {
 	// Create a new problem based on date provided in the file
 	TSPProblem* tspProblem = new TSPProblem(filename);
 	cout << "Problem dimension: " << tspProblem->get_size() << "." << endl;
+	cout << "Seed: " << options.seed << "." << endl;
+	tspProblem->set_threads((options.islands > 1) ? options.islands : options.threads);
 
 	// Solving problem using CPLEX
 	TSPSolution* cplexSol;
@@ -282,17 +473,29 @@ int single_test(string filename) {
 
 	cout << "Solving with GA..." <<endl;
 	s_time = current_timestamp();
-	GASolver* gaSolver = new GASolver(tspProblem,\
-									ga_population_size_factor,\
-									time_limit,\
-									ga_iteration_limit,\
-									ga_mutation_probability,
-									verbose);
-	GAIndividual* gaSol = gaSolver->solve();
+	GAIndividual* gaSol = run_ga(tspProblem,\
+								ga_population_size_factor,\
+								time_limit,\
+								ga_iteration_limit,\
+								ga_mutation_probability,
+								verbose,
+								options,
+								trace_filename(options, filename));
 	e_time = current_timestamp();
 	ga_time = e_time - s_time;
 	cout << " Done." << endl;
 
+	// Solving problem using the local search (LK)
+	unsigned int lk_iteration_limit = 20000;	// maximum number of kicks
+
+	cout << "Solving with LK..." <<endl;
+	s_time = current_timestamp();
+	LKSolver lkSolver(tspProblem, time_limit, lk_iteration_limit, verbose, options.seed);
+	TSPSolution* lkSol = lkSolver.solve();
+	e_time = current_timestamp();
+	lk_time = e_time - s_time;
+	cout << " Done." << endl;
+
 	cout << endl;
 	cout << "--------------  CPLEX	--------------"<<endl;
 	if ( cplexSol != NULL) {
@@ -324,6 +527,18 @@ int single_test(string filename) {
 	cout << " Time: " << ga_time << " [ms]." << endl;
 	cout << endl;
 
+	cout << "--------------    LK 	--------------" << endl;
+	cout << " Solution found." << endl;
+	cout << " Cost: " << lkSol->get_solution_cost() << "." << endl;
+	cout << " Path: ";
+	if (tspProblem->get_size() <= 20) {
+		lkSol->print_path();
+	} else {
+		cout << " too long. " << endl;
+	}
+	cout << " Time: " << lk_time << " [ms]." << endl;
+	cout << endl;
+
 	if ( cplexSol != NULL) {
 		cout << "Gap between solutions : " << \
 			(1-(gaSol->get_fitness() / cplexSol->get_solution_cost())) * 100 << \
@@ -334,6 +549,131 @@ int single_test(string filename) {
 }
 
 
+/**
+*	@brief	Solve a problem with the GA, picking the compiled-in
+*			configuration of operators (see GAOperators.h) that matches
+*			the options. EAX needs a symmetric problem: the order
+*			crossover is used otherwise.
+*
+*	@return the best individual found
+*/
+GAIndividual* run_ga(TSPProblem* tspProblem, unsigned int pop_size_factor, \
+					unsigned int time_limit, unsigned int iteration_limit, \
+					double mutation_probability, bool verbose, const Options& options, \
+					const string& trace_file) {
+	bool eax = (options.crossover == EAX_CROSSOVER) && tspProblem->is_symmetric();
+	bool truncation = (options.replacement == TRUNCATION_REPLACEMENT);
+
+	if (eax) {
+		return truncation ? \
+			run_ga_with<EAXTruncationGA>(tspProblem, pop_size_factor, time_limit, iteration_limit, \
+										mutation_probability, verbose, options, trace_file) : \
+			run_ga_with<EAXRouletteGA>(tspProblem, pop_size_factor, time_limit, iteration_limit, \
+										mutation_probability, verbose, options, trace_file);
+	}
+	return truncation ? \
+		run_ga_with<OrderTruncationGA>(tspProblem, pop_size_factor, time_limit, iteration_limit, \
+										mutation_probability, verbose, options, trace_file) : \
+		run_ga_with<OrderRouletteGA>(tspProblem, pop_size_factor, time_limit, iteration_limit, \
+										mutation_probability, verbose, options, trace_file);
+}
+
+/**
+*	@brief	Solve a problem with the GA using the operators <Operators>:
+*			the island model if more than one island is requested,
+*			the plain one otherwise (which writes the convergence
+*			trace to <trace_file>, if any).
+*
+*	@return the best individual found
+*/
+template <class Operators>
+GAIndividual* run_ga_with(TSPProblem* tspProblem, unsigned int pop_size_factor, \
+						unsigned int time_limit, unsigned int iteration_limit, \
+						double mutation_probability, bool verbose, const Options& options, \
+						const string& trace_file) {
+	if (options.islands > 1) {
+		GAIslandSolver<Operators> gaSolver(tspProblem,\
+								pop_size_factor,\
+								time_limit,\
+								iteration_limit,\
+								mutation_probability,
+								options.islands,
+								options.topology,
+								verbose,
+								options.seed);
+		gaSolver.set_local_search(options.local_search);
+		gaSolver.set_polish(options.polish);
+		return gaSolver.solve();
+	}
+
+	GASolver<Operators> gaSolver(tspProblem,\
+					pop_size_factor,\
+					time_limit,\
+					iteration_limit,\
+					mutation_probability,
+					verbose,
+					options.threads,
+					options.seed);
+	gaSolver.set_local_search(options.local_search);
+	gaSolver.set_polish(options.polish);
+	gaSolver.set_trace(trace_file);
+	return gaSolver.solve();
+}
+
+/**
+*	@brief	Name of the convergence trace of the GA run on <instance>:
+*			the -t prefix followed by the instance name, without
+*			directory and extension (empty if there's no -t)
+*
+*	@return file name
+*/
+string trace_filename(const Options& options, const string& instance) {
+	if (options.trace_prefix.empty()) { return ""; }
+
+	string name = instance.substr(instance.find_last_of('/') + 1);
+	name = name.substr(0, name.find_last_of('.'));
+	return options.trace_prefix + name + ".gatrace";
+}
+
+/**
+*	@brief	Convert a text instance (or all the .tsp instances in a directory)
+*			into the binary format: <instance>.tsp --> <instance>.tspb
+*
+*	@return exit status (int)
+*/
+int convert_instances(string input) {
+	vector<string> instances;
+
+	if (is_dir(input.c_str())) {
+		vector<string> files;
+		getdir(input, files);
+		for (auto & el : files) {
+			if ((el.size() > 4) && (el.substr(el.size()-4) == ".tsp")) {
+				instances.push_back( input + "/" + el );
+			}
+		}
+		std::sort(instances.begin(), instances.end());
+	} else if (is_file(input.c_str())) {
+		instances.push_back(input);
+	} else {
+		cout << "Error." << endl;
+		return -2;
+	}
+
+	for (auto & instance : instances) {
+		try {
+			TSPProblem tspProblem(instance);
+			tspProblem.save_binary(instance + "b");
+			cout << "Converted \'" << instance << "\' (" << tspProblem.get_size() << " nodes)." << endl;
+		} catch(std::exception& e) {
+			std::cout << "[!] EXCEPTION: " << e.what() << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	return 0;
+}
+
 /**
 *	@brief	Read files in a given directory
 */
@@ -359,7 +699,7 @@ int getdir (string dir, vector<string> &files) {
 */
 bool is_file(const char* path) {
 	struct stat buf;
-	stat(path, &buf);
+	if (stat(path, &buf) != 0) { return false; }
 	return S_ISREG(buf.st_mode);
 }
 
@@ -370,7 +710,7 @@ bool is_file(const char* path) {
 */
 bool is_dir(const char* path) {
 	struct stat buf;
-	stat(path, &buf);
+	if (stat(path, &buf) != 0) { return false; }
 	return S_ISDIR(buf.st_mode);
 }
 